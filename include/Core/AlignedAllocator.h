@@ -0,0 +1,45 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <new>
+
+namespace QuantEngine {
+    // Standard allocator returning storage aligned to Alignment bytes (a cache line by default)
+    // Used for columnar containers so batch kernels can stream whole lines and vectorize cleanly
+    template<typename T, std::size_t Alignment = 64>
+    class AlignedAllocator {
+    public:
+        using value_type = T;
+
+        // Rebinding keeps the alignment for other element types
+        template<typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        // Allocates n elements on an Alignment boundary
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ Alignment }));
+        }
+
+        // Returns storage obtained from allocate
+        void deallocate(T* p, std::size_t) noexcept {
+            ::operator delete(p, std::align_val_t{ Alignment });
+        }
+
+        // Stateless, so every instance can free every other's memory
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    };
+}
\ No newline at end of file
@@ -2,12 +2,19 @@
 #pragma once
 
 // Same project headers.
-// ....
+#include "Core/PriceStore.h"
+#include "Core/RateLimiter.h"
+#include "Core/ResponseCache.h"
 // 3rd party headers.
 // ....
 // std headers.
+#include <chrono>
+#include <future>
 #include <string>
 #include <map>
+#include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace QuantEngine {
@@ -27,15 +34,80 @@ namespace QuantEngine {
         // Symbol format depends on data provider (e.g., "AAPL" or "AAPL.OQ")
         static StockData fetchStockData(const std::string& symbol);
 
+        // Market data for a whole watchlist, fetched concurrently with at most maxConcurrent requests in flight
+        // Entries line up with symbols; a symbol whose spot price could not be fetched is left empty
+        static std::vector<std::optional<StockData>> fetchStockData(std::span<const std::string> symbols,
+            std::size_t maxConcurrent = 16);
+
         // ----- Market data utilities -----
 
         // Returns current risk-free rate (typically 10yr Treasury yield)
+        // Memoized for the session: reloaded once older than the refresh age, with one request shared by concurrent callers
+        // Throws when FRED has no current value (nothing is memoized); fetchStockData then uses 5%
         static double fetchRiskFreeRate();
 
+        // Maximum age of the memoized rate (default one hour); zero refetches on every call
+        static void setRiskFreeRateRefresh(std::chrono::seconds maxAge);
+
+        // Drops the memoized rate so the next call refetches
+        static void invalidateRiskFreeRate();
+
         // Calculates historical volatility for given symbol
         // Requires valid API key for data provider
+        // Every daily-series path (single, batch, async) uses completed sessions only: the current
+        // session's bar is dropped until its US close (PriceStore::lastCompletedSession)
+        // With a price store, uses the stored completed sessions and fetches only when they are out of date
         static double fetchHistoricalVolatility(const std::string& symbol, const std::string& apiKey);
 
+        // Daily closing prices, oldest first, for the most recent days sessions
+        // With a price store, stored sessions are served first and only missing ones are downloaded;
+        // the full history is requested when the gap or the request exceeds the provider's 100-session compact series
+        static std::vector<double> fetchHistoricalPrices(const std::string& symbol, const std::string& apiKey,
+            std::size_t days);
+
+        // ----- Asynchronous API -----
+        // Same results and fallbacks as the blocking calls (without the throttling retry), but requests run
+        // on one shared I/O reactor thread and the calls return at once; cache hits resolve immediately
+        // Arrived bodies are cached and parsed on a few completion workers, never on the I/O thread
+        // Errors the blocking calls would throw are delivered through the future
+
+        static std::future<StockData> fetchStockDataAsync(const std::string& symbol);
+        static std::future<double> fetchRiskFreeRateAsync();
+        static std::future<double> fetchHistoricalVolatilityAsync(const std::string& symbol, const std::string& apiKey);
+        static std::future<std::vector<double>> fetchHistoricalPricesAsync(const std::string& symbol,
+            const std::string& apiKey, std::size_t days);
+
+        // Async requests still in flight or waiting for a completion worker
+        static std::size_t pendingAsyncRequests();
+
+        // ----- Response caching -----
+
+        // Cache consulted before every request; defaults to quantengine_http_cache in the temp directory
+        // Pass nullptr to always go to the network
+        static void setResponseCache(std::shared_ptr<ResponseCache> cache);
+        static std::shared_ptr<ResponseCache> responseCache();
+
+        // ----- Local price history -----
+
+        // Store read first by fetchHistoricalVolatility and fetchHistoricalPrices; defaults to
+        // quantengine_price_store in the temp directory. Pass nullptr to always use the provider's series
+        static void setPriceStore(std::shared_ptr<PriceStore> store);
+        static std::shared_ptr<PriceStore> priceStore();
+
+        // ----- Request pacing -----
+
+        // Replaces the limiter for a provider ("alpha_vantage" or "fred"), e.g. for a premium quota
+        // Every network request to that provider, single or batched, takes a token first
+        // (HttpTransport replays are not paced)
+        // Blocking calls sleep the calling thread until their token is due: at the free Alpha Vantage quota
+        // that is about 12 s per uncached request after the first, and fetchStockData(symbol) makes two.
+        // The batch and *Async calls queue on reservations instead; check rateLimiter(provider)->waitEstimate()
+        // to decide before a blocking call
+        static void setRateLimit(const std::string& provider, double requestsPerMinute, double burst = 1.0);
+
+        // Shared limiter for a provider (queue depth and wait metrics), nullptr if unknown
+        static std::shared_ptr<RateLimiter> rateLimiter(const std::string& provider);
+
     private:
         // Internal API key management
         static const std::string API_KEY;      // Primary service API key
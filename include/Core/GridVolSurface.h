@@ -0,0 +1,74 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/VolatilitySurface.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace QuantEngine {
+    // Compact node encodings for grid surfaces
+    enum class VolatilityStorage : std::uint8_t {
+        Float32,    // float axes and nodes (half the bytes of double)
+        Int16       // float axes, nodes quantized to int16 with a shared scale/offset
+    };
+
+    // Dense strike x maturity grid read through non-owning spans
+    // Lets a memory-mapped snapshot or a compressed buffer act as a surface without copying its nodes
+    // Storage may be narrower than T (float, or int16 with scale); interpolation always runs in double
+    // Interpolation and bounds rules match MarketData::getVolatility
+    template<typename T, typename Storage = T>
+    class GridVolSurface : public VolatilitySurface<T> {
+    public:
+        // Axes are stored as float when nodes are quantized, otherwise in the node type
+        using Axis = std::conditional_t<std::is_integral_v<Storage>, float, Storage>;
+
+        // Node value reserved for missing points in quantized grids
+        static constexpr std::int16_t MissingNode = INT16_MIN;
+
+        // Views sorted axes and row-major nodes (vols[i * maturities.size() + j])
+        // Missing nodes are NaN (or MissingNode when quantized); decoded vol = offset + scale * node
+        // owner keeps the memory behind the spans alive for as long as the surface exists
+        GridVolSurface(std::span<const Axis> strikes, std::span<const Axis> maturities,
+            std::span<const Storage> volatilities, std::shared_ptr<const void> owner = nullptr,
+            double scale = 1.0, double offset = 0.0);
+
+        // Builds a self-owning grid encoded in Storage from full-precision axes and nodes (NaN = missing)
+        static std::shared_ptr<const GridVolSurface> compress(std::span<const T> strikes,
+            std::span<const T> maturities, std::span<const T> volatilities);
+
+        // Exact node, or bilinear interpolation between the four surrounding nodes
+        T volatility(T strike, T maturity) const override;
+
+        // Grid axes and raw node values
+        std::span<const Axis> strikes() const { return strikes_; }
+        std::span<const Axis> maturities() const { return maturities_; }
+        std::span<const Storage> volatilities() const { return vols_; }
+
+        // Decoded node at (strike index, maturity index), NaN when missing
+        double nodeVolatility(std::size_t i, std::size_t j) const;
+
+        // Largest absolute error introduced by the node encoding
+        double maxEncodingError() const;
+
+        // Bytes held by axes and nodes
+        std::size_t footprint() const;
+
+    private:
+        // Decoded node value; throws if the node is missing
+        double node(std::size_t i, std::size_t j) const;
+
+        std::span<const Axis> strikes_;
+        std::span<const Axis> maturities_;
+        std::span<const Storage> vols_;
+        std::shared_ptr<const void> owner_;
+        double scale_;
+        double offset_;
+    };
+}
\ No newline at end of file
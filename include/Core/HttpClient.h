@@ -0,0 +1,89 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace QuantEngine {
+    // Blocking HTTP GET on persistent libcurl handles
+    // Every thread keeps one easy handle (and so its open keep-alive connections) for its lifetime,
+    // and all handles share one DNS and TLS session cache, so repeat requests skip the handshakes
+    class HttpClient {
+    public:
+        // Outcome of one transfer in a batch
+        struct Response {
+            std::string body;       // Received bytes (empty on failure)
+            std::string error;      // libcurl error text, empty on success
+
+            bool ok() const { return error.empty(); }
+        };
+
+        // Fetches url with the calling thread's handle; throws std::runtime_error on transfer failure
+        static std::string get(const std::string& url);
+
+        // Returns the earliest time transfer i may start; called once per url, in order
+        using Schedule = std::function<std::chrono::steady_clock::time_point(std::size_t)>;
+
+        // Fetches every url concurrently through the calling thread's curl multi handle
+        // At most maxConcurrent transfers are in flight; results come back in url order
+        // and a failed transfer is reported in its Response instead of aborting the batch
+        // An optional schedule (e.g. RateLimiter reservations) holds transfers back while others keep running
+        static std::vector<Response> getAll(std::span<const std::string> urls, std::size_t maxConcurrent = 16,
+            const Schedule& schedule = {});
+
+        // Event loop on a dedicated I/O thread that runs submitted requests through one curl multi handle
+        // Submitting never blocks; completion callbacks run on the reactor thread and should stay short
+        class Reactor {
+        public:
+            using Clock = std::chrono::steady_clock;
+            using Callback = std::function<void(Response)>;
+
+            // Starts the I/O thread; at most maxConcurrent transfers run at once
+            explicit Reactor(std::size_t maxConcurrent = 16);
+
+            // Stops the loop; requests still queued or running complete with an error Response
+            ~Reactor();
+
+            Reactor(const Reactor&) = delete;
+            Reactor& operator=(const Reactor&) = delete;
+
+            // Queues url to start no earlier than notBefore (e.g. a RateLimiter reservation)
+            // A callback that throws is ignored so the loop keeps serving other requests
+            void submit(std::string url, Callback done, Clock::time_point notBefore = {});
+
+            // Future-returning form of submit
+            std::future<Response> get(std::string url, Clock::time_point notBefore = {});
+
+            // Requests submitted but not yet completed
+            std::size_t pending() const;
+
+        private:
+            struct State;
+
+            // Reactor thread body
+            void run();
+
+            std::unique_ptr<State> state_;
+            std::thread thread_;
+        };
+
+        // Easy handles created so far (one per thread that has issued a request)
+        static std::size_t handlesCreated();
+
+        // Request timeouts in seconds
+        static constexpr long TimeoutSeconds = 10;
+        static constexpr long ConnectTimeoutSeconds = 5;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace QuantEngine {
+    // Process-wide switch under HttpClient between the network and on-disk fixtures
+    //   Live:   requests go to the network
+    //   Record: requests go to the network and every successful body is saved as a fixture
+    //   Replay: no network; bodies come from fixtures after a simulated latency (a missing fixture is a failed transfer)
+    // Fixtures are named after the ResponseCache key, so they never contain API keys and replay under any key
+    class HttpTransport {
+    public:
+        enum class Mode { Live, Record, Replay };
+
+        struct Settings {
+            Mode mode = Mode::Live;
+            std::filesystem::path fixtures;             // Fixture directory for Record and Replay
+            std::chrono::milliseconds latency{ 0 };     // Mean simulated latency per replayed request
+            std::chrono::milliseconds jitter{ 0 };      // Uniform +/- spread around latency
+            std::uint64_t seed = 1;                     // Jitter sequence seed, for repeatable benchmarks
+        };
+
+        // Installs settings for all subsequent requests (and restarts the jitter sequence)
+        static void configure(const Settings& settings);
+        static Settings settings();
+        static Mode mode();
+
+        // Fixture file for url inside directory
+        static std::filesystem::path fixturePath(const std::filesystem::path& directory, const std::string& url);
+
+        // Recorded body for url in the configured fixture directory
+        static std::optional<std::string> replay(const std::string& url);
+
+        // Saves body as url's fixture (via a temporary file and rename); throws if no fixture directory is set
+        static void record(const std::string& url, std::string_view body);
+
+        // Next simulated latency: latency plus uniform jitter, never negative
+        static std::chrono::milliseconds nextLatency();
+    };
+}
\ No newline at end of file
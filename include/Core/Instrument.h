@@ -2,13 +2,15 @@
 #pragma once
 
 // Same project headers.
-// ....
+#include "Core/Observable.h"
 // 3rd party headers.
 // ....
 // std headers.
-#include <map>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <string>
+#include <string_view>
 
 // Forward declare classes to avoid header dependencies
 // Allows using MarketData/PricingEngine types without full definitions here
@@ -18,10 +20,41 @@ namespace QuantEngine {
 }
 
 namespace QuantEngine {
+    // Risk sensitivities reported by engines, used as indices into Greeks<T>
+    enum class Greek : std::uint8_t {
+        Delta,  // Price sensitivity to underlying price
+        Gamma,  // Delta's sensitivity to underlying price
+        Vega,   // Price sensitivity to volatility (per 1% change)
+        Theta,  // Price sensitivity to time (daily decay)
+        Rho     // Price sensitivity to interest rates (per 1% change)
+    };
+
+    inline constexpr std::size_t GreekCount = 5;
+
+    // Every Greek in index order, for loops over Greeks<T>
+    inline constexpr std::array<Greek, GreekCount> AllGreeks{
+        Greek::Delta, Greek::Gamma, Greek::Vega, Greek::Theta, Greek::Rho };
+
+    // Display name of a Greek (only needed for output, never for lookups)
+    constexpr std::string_view greekName(Greek greek) {
+        constexpr std::array<std::string_view, GreekCount> names{ "delta", "gamma", "vega", "theta", "rho" };
+        return names[static_cast<std::size_t>(greek)];
+    }
+
+    // Fixed-size set of Greeks indexed by the Greek enum
+    template<typename T>
+    struct Greeks {
+        std::array<T, GreekCount> values{};
+
+        constexpr T& operator[](Greek greek) { return values[static_cast<std::size_t>(greek)]; }
+        constexpr const T& operator[](Greek greek) const { return values[static_cast<std::size_t>(greek)]; }
+    };
+
     // Base class for all financial instruments
     // Derived classes must implement pricing and risk calculations
+    // Observers are notified whenever cached results become stale
     template<typename T>
-    class Instrument {
+    class Instrument : public Observable {
     public:
         // Allows proper cleanup of derived class objects
         virtual ~Instrument() = default;
@@ -30,7 +63,7 @@ namespace QuantEngine {
         virtual T price() const = 0;
 
         // Computes risk metrics (delta, gamma, etc.)
-        virtual std::map<std::string, T> greeks() const = 0;
+        virtual Greeks<T> greeks() const = 0;
 
         // Updates with latest market conditions
         virtual void updateMarketData(const MarketData<T>& market) = 0;
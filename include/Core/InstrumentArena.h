@@ -0,0 +1,92 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Instruments/EuropeanStockOption.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace QuantEngine {
+    // Bump-pointer arena for bulk-loading instruments, engines and the data they own
+    // Objects are placed back to back in large blocks with no per-object heap call or control block;
+    // reset() runs the recorded destructors in reverse order and returns every block at once
+    class InstrumentArena {
+    public:
+        // initialBytes sizes the first block; later blocks grow geometrically from upstream
+        explicit InstrumentArena(std::size_t initialBytes = 1 << 20,
+            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+        // Destroys everything still in the arena
+        ~InstrumentArena();
+
+        InstrumentArena(const InstrumentArena&) = delete;
+        InstrumentArena& operator=(const InstrumentArena&) = delete;
+
+        // Resource for allocator-aware members (pmr containers, MarketData)
+        std::pmr::memory_resource* resource() { return &buffer_; }
+
+        // Constructs an Object in the arena; it lives until reset()
+        template<typename Object, typename... Args>
+        Object& create(Args&&... args);
+
+        // Option whose market data snapshot is also stored in the arena
+        // Observing the engine costs one heap node per option in the engine's observer set (all inserts
+        // contend on one lock); bulk loads of options the engine never needs to reprice can pass false
+        template<typename T>
+        EuropeanStockOption<T>& createEuropeanOption(const typename Instrument<T>::Parameters& params,
+            std::shared_ptr<PricingEngine<T>> engine, const MarketData<T>& market, bool observeEngine = true);
+
+        // Non-owning shared_ptr for APIs that take one (e.g. setPricingEngine)
+        // No control block is allocated; the pointer is valid until reset()
+        template<typename Object>
+        static std::shared_ptr<Object> share(Object& object) {
+            return std::shared_ptr<Object>(std::shared_ptr<void>(), &object);
+        }
+
+        // Objects currently alive in the arena
+        std::size_t objectCount() const { return objects_; }
+
+        // Destroys all objects (newest first) and releases all memory in one step
+        // Any reference or shared_ptr from share() becomes dangling
+        void reset();
+
+    private:
+        // Type-erased destructor call for a non-trivially destructible object
+        struct Cleanup {
+            void* object;
+            void (*destroy)(void*);
+        };
+
+        std::pmr::monotonic_buffer_resource buffer_;
+        std::vector<Cleanup> cleanups_;
+        std::size_t objects_ = 0;
+    };
+
+    template<typename Object, typename... Args>
+    Object& InstrumentArena::create(Args&&... args) {
+        // Reserve the cleanup slot first so a failed push cannot orphan a live object
+        // Capacity doubles, as reserve(size() + 1) would reallocate on every call
+        if constexpr (!std::is_trivially_destructible_v<Object>) {
+            if (cleanups_.size() == cleanups_.capacity()) {
+                cleanups_.reserve(std::max<std::size_t>(2 * cleanups_.capacity(), 64));
+            }
+        }
+
+        void* memory = buffer_.allocate(sizeof(Object), alignof(Object));
+        Object* object = ::new (memory) Object(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<Object>) {
+            cleanups_.push_back({ object, [](void* p) { static_cast<Object*>(p)->~Object(); } });
+        }
+        ++objects_;
+        return *object;
+    }
+}
\ No newline at end of file
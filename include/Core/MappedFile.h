@@ -0,0 +1,46 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <string>
+
+namespace QuantEngine {
+    // Read-only memory mapping of a whole file
+    // Pages are shared through the OS page cache by every process mapping the same file
+    class MappedFile {
+    public:
+        // Maps the file at path; throws if it cannot be opened or mapped
+        explicit MappedFile(const std::string& path);
+
+        // Unmaps the file
+        ~MappedFile();
+
+        // Mappings own OS handles, so they move but never copy
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Start of the mapped bytes (null for an empty file)
+        const std::byte* data() const { return data_; }
+
+        // Number of mapped bytes
+        std::size_t size() const { return size_; }
+
+    private:
+        // Releases the mapping and any OS handles
+        void close() noexcept;
+
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        void* file_ = nullptr;      // HANDLE from CreateFile
+        void* mapping_ = nullptr;   // HANDLE from CreateFileMapping
+#endif
+    };
+}
\ No newline at end of file
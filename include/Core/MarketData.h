@@ -2,23 +2,51 @@
 #pragma once
 
 // Same project headers.
-// ....
+#include "Core/GridVolSurface.h"
+#include "Core/VolatilitySurface.h"
+#include "Core/YieldCurve.h"
 // 3rd party headers.
 // ....
 // std headers.
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <vector>
 
+// Forward declare the bulk loader and snapshot writer that access MarketData internals directly
+namespace QuantEngine {
+    template<typename T> class MarketDataBuilder;
+    template<typename T> class MarketDataSnapshot;
+}
+
 namespace QuantEngine {
     // Stores current market conditions needed for pricing financial instruments  
     // Handles interest rates and volatility data  
     template<typename T>
     class MarketData {
     public:
+        // Uses the default memory resource for rate and volatility storage  
+        MarketData() = default;
+
+        // Allocates rate and volatility storage from resource (e.g. an InstrumentArena)  
+        // Later assignments keep using resource, so per-instrument copies stay in the arena  
+        explicit MarketData(std::pmr::memory_resource* resource);
+
+        // Copies other into storage drawn from resource  
+        MarketData(const MarketData& other, std::pmr::memory_resource* resource);
+
+        MarketData(const MarketData&) = default;
+        MarketData(MarketData&&) = default;
+        MarketData& operator=(const MarketData&) = default;
+        MarketData& operator=(MarketData&&) = default;
+
         // Records interest rate for a specific time period (e.g., 0.5 years = 6 months)  
         void addRiskFreeRate(T time, T rate);
 
         // Saves volatility for specific price targets and expiration dates  
+        // Throws std::logic_error while a surface is attached or the points were compressed, since lookups  
+        // would keep answering from that surface  
         void addVolatility(T strike, T maturity, T volatility);
 
         // Estimates interest rate for any time using stored data  
@@ -27,19 +55,69 @@ namespace QuantEngine {
         // Finds volatility for specific price/expiration combination  
         T getVolatility(T strike, T maturity) const;
 
+        // Discount factor for any time, served from the attached curve's shared cache when present  
+        // Falls back to exp(-r*t) on the interpolated rate otherwise  
+        T getDiscountFactor(T time) const;
+
+        // Attaches a precomputed curve that takes over rate and discount lookups  
+        // Copies of this MarketData share the curve and its discount cache  
+        void setYieldCurve(std::shared_ptr<const YieldCurve<T>> curve);
+
+        // Builds and attaches a curve from the rates recorded so far  
+        void buildYieldCurve(typename YieldCurve<T>::Interpolation method);
+
+        // Currently attached curve (null when using raw rate points)  
+        std::shared_ptr<const YieldCurve<T>> getYieldCurve() const { return curve_; }
+
+        // Attaches a parametric or precomputed surface that takes over volatility lookups  
+        // Copies of this MarketData share the surface  
+        void setVolatilitySurface(std::shared_ptr<const VolatilitySurface<T>> surface);
+
+        // Currently attached surface (null when using raw volatility points)  
+        std::shared_ptr<const VolatilitySurface<T>> getVolatilitySurface() const { return surface_; }
+
+        // Moves the volatility points into a dense grid with compact node storage  
+        // Frees the point map; lookups then decode float/int16 nodes and interpolate in double  
+        void compressVolatilities(VolatilityStorage storage);
+
+        // Copy with every rate moved by rateShift and every volatility by volShift  
+        // Rates are floored at zero and vols at a small positive value; attached surfaces are wrapped, not rebuilt  
+        MarketData shocked(T rateShift, T volShift) const;
+
+        // Identifies the current market state for price caches  
+        // Unique across the process and renewed by every mutation; copies keep their source's version  
+        std::uint64_t version() const { return version_; }
+
     private:
+        // Bulk loader writes the sorted containers directly  
+        friend class MarketDataBuilder<T>;
+        // Snapshot writer reads them without copying through the public API  
+        friend class MarketDataSnapshot<T>;
+
         // Time-based interest rate storage  
         // Format: {2.0 years -> 3.5% rate}  
-        std::map<T, T> yield_curve_;
+        std::pmr::map<T, T> yield_curve_;
+
+        // Optional precomputed curve built from (or replacing) the rate points  
+        std::shared_ptr<const YieldCurve<T>> curve_;
 
         // Volatility storage by price target and expiration  
         // Format: {110 strike, 1-year maturity -> 25% volatility}  
-        std::map<std::pair<T, T>, T> vol_surface_;
+        std::pmr::map<std::pair<T, T>, T> vol_surface_;
+
+        // Optional surface replacing the raw volatility points  
+        std::shared_ptr<const VolatilitySurface<T>> surface_;
 
         // All saved price targets (kept sorted for quick access)  
-        std::vector<T> strikes_;
+        std::pmr::vector<T> strikes_;
 
         // All saved expiration times (kept in order for quick access)  
-        std::vector<T> maturities_;
+        std::pmr::vector<T> maturities_;
+
+        // Draws the next process-wide version number  
+        static std::uint64_t nextVersion();
+
+        // Current state identifier (see version())  
+        std::uint64_t version_ = nextVersion();
     };
-}
+}
\ No newline at end of file
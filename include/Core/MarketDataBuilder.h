@@ -0,0 +1,56 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/MarketData.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace QuantEngine {
+    // Bulk loader for MarketData
+    // Stages whole arrays of rates and volatilities, then sorts and deduplicates once in build()
+    // Loading n points costs O(n log n) instead of the O(n^2) of repeated addVolatility calls
+    template<typename T>
+    class MarketDataBuilder {
+    public:
+        // Pre-sizes staging buffers to avoid regrowth during large loads
+        MarketDataBuilder& reserve(std::size_t rateCount, std::size_t volCount);
+
+        // Stages one rate point (same validation as MarketData::addRiskFreeRate)
+        MarketDataBuilder& addRiskFreeRate(T time, T rate);
+
+        // Stages a column batch of rate points
+        MarketDataBuilder& addRiskFreeRates(std::span<const T> times, std::span<const T> rates);
+
+        // Stages one volatility point (same validation as MarketData::addVolatility)
+        MarketDataBuilder& addVolatility(T strike, T maturity, T volatility);
+
+        // Stages a column batch of (strike, maturity, volatility) points
+        MarketDataBuilder& addVolatilities(std::span<const T> strikes, std::span<const T> maturities,
+            std::span<const T> volatilities);
+
+        // Stages a full grid given as strike and maturity axes plus row-major vols
+        // volatilities[i * maturities.size() + j] is the vol at (strikes[i], maturities[j])
+        MarketDataBuilder& addVolatilityGrid(std::span<const T> strikes, std::span<const T> maturities,
+            std::span<const T> volatilities);
+
+        // Produces the final MarketData and empties the builder
+        // Later points overwrite earlier ones with the same key, matching MarketData semantics
+        MarketData<T> build();
+
+    private:
+        // Staged volatility point (insertion order is preserved by stable sorting)
+        struct VolPoint {
+            T strike;
+            T maturity;
+            T volatility;
+        };
+
+        std::vector<std::pair<T, T>> rates_;
+        std::vector<VolPoint> vols_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/GridVolSurface.h"
+#include "Core/MappedFile.h"
+#include "Core/MarketData.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace QuantEngine {
+    // Versioned binary snapshot of MarketData that is used straight from a memory mapping
+    // Layout: 128-byte header followed by 64-byte aligned arrays
+    //   rate times | rates | strikes | maturities | dense vol grid (row-major by strike, NaN = missing)
+    // Processes mapping the same file share one page-cache copy and skip all parsing
+    template<typename T>
+    class MarketDataSnapshot {
+    public:
+        // On-disk header; all integers use the writer's native byte order
+        struct Header {
+            char magic[8];                  // "QEMDSNAP"
+            std::uint32_t version;          // Format version (see FormatVersion)
+            std::uint32_t endianTag;        // 0x01020304 as written, detects foreign byte order
+            std::uint32_t scalarSize;       // sizeof(T) used for every array
+            std::uint32_t curveMethod;      // YieldCurve interpolation, NoCurve if none attached
+            std::uint64_t rateCount;        // Entries in the rate time/value arrays
+            std::uint64_t strikeCount;      // Entries in the strike axis
+            std::uint64_t maturityCount;    // Entries in the maturity axis
+            std::uint64_t offsets[5];       // Byte offsets of the five arrays
+        };
+
+        static constexpr std::uint32_t FormatVersion = 1;
+        static constexpr std::uint32_t NoCurve = 0xFFFFFFFFu;
+        static constexpr std::size_t Alignment = 64;
+        static constexpr std::size_t HeaderSize = 128;
+
+        // Writes market to path (via a temporary file and rename, so live readers keep their old mapping)
+        // Grid points and grid surfaces (including compressed ones) are saved; parametric surfaces are skipped
+        static void save(const MarketData<T>& market, const std::string& path);
+
+        // Maps path and validates the header; throws on wrong magic, version, byte order or size
+        explicit MarketDataSnapshot(const std::string& path);
+
+        // Zero-copy views into the mapped arrays
+        std::span<const T> rateTimes() const { return rateTimes_; }
+        std::span<const T> rates() const { return rates_; }
+        std::span<const T> strikes() const { return strikes_; }
+        std::span<const T> maturities() const { return maturities_; }
+        std::span<const T> volatilities() const { return vols_; }
+
+        // Linearly interpolated rate, flat outside the stored range (as MarketData::getRiskFreeRate)
+        T getRiskFreeRate(T time) const;
+
+        // Volatility from the mapped grid (as MarketData::getVolatility)
+        T getVolatility(T strike, T maturity) const;
+
+        // Surface reading the mapped grid directly; keeps the mapping alive
+        std::shared_ptr<const GridVolSurface<T>> volatilitySurface() const { return surface_; }
+
+        // MarketData pricing off this snapshot
+        // The vol grid stays in the mapping; only the handful of rate points are copied
+        MarketData<T> toMarketData() const;
+
+    private:
+        std::shared_ptr<const MappedFile> file_;
+        std::uint32_t curveMethod_ = NoCurve;
+        std::span<const T> rateTimes_, rates_, strikes_, maturities_, vols_;
+        std::shared_ptr<const GridVolSurface<T>> surface_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace QuantEngine {
+    // Session-wide memo for one slowly changing value (e.g. the risk-free rate)
+    // A value younger than maxAge is returned as is; otherwise a single caller reloads it
+    // while concurrent callers wait on that same load instead of issuing their own (single flight)
+    template<typename T>
+    class MemoizedValue {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit MemoizedValue(Clock::duration maxAge) : maxAge_(maxAge) {}
+
+        // Receives a ready future holding the value or the load's error
+        using Callback = std::function<void(std::shared_future<T>)>;
+
+        // Cached value, or the result of load run once for every caller that arrives while it runs
+        // A throwing load caches nothing and rethrows to each of those callers
+        T get(const std::function<T()>& load);
+
+        // Non-blocking form for event loops: callback runs at once with a fresh value, or when the load
+        // finishes; only the first caller's start runs, and it must end the load with complete() or fail()
+        void getAsync(Callback callback, const std::function<void()>& start);
+
+        // Ends the running load, caching value (or nothing on failure) and notifying every waiter
+        void complete(T value);
+        void fail(std::exception_ptr error);
+
+        // Refresh policy; zero reloads on every call that does not join a running load
+        void setMaxAge(Clock::duration maxAge);
+        Clock::duration maxAge() const;
+
+        // Forgets the cached value so the next call reloads
+        void invalidate();
+
+        // Number of times load has run
+        std::uint64_t loads() const;
+
+    private:
+        // Joins the running load or begins one (leader = true); queues callback for its result
+        // Returns an invalid future and copies the value into fresh when a fresh value is cached
+        std::shared_future<T> join(Callback callback, bool& leader, std::optional<T>& fresh);
+
+        // Hands the finished load's future to its waiters
+        void settle(const std::function<void(std::promise<T>&)>& resolve, const std::optional<T>& value);
+
+        mutable std::mutex mutex_;
+        Clock::duration maxAge_;
+        std::optional<T> value_;
+        Clock::time_point loadedAt_;
+        std::shared_ptr<std::promise<T>> promise_;
+        std::shared_future<T> inFlight_;
+        std::vector<Callback> waiters_;
+        std::uint64_t loads_ = 0;
+    };
+}
\ No newline at end of file
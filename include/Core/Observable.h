@@ -0,0 +1,48 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <mutex>
+#include <unordered_set>
+
+namespace QuantEngine {
+    // Receives change notifications from the Observables it registered with
+    class Observer {
+    public:
+        virtual ~Observer() = default;
+
+        // Called when an observed object has changed; should only mark state stale
+        virtual void update() = 0;
+    };
+
+    // Notifies registered observers when its state changes
+    // Copies start with no observers: registrations belong to the original object
+    class Observable {
+    public:
+        Observable() = default;
+        Observable(const Observable&) {}
+        Observable& operator=(const Observable&) { return *this; }
+        virtual ~Observable() = default;
+
+        // Adds observer; registering twice has no effect
+        void registerObserver(Observer* observer);
+
+        // Removes observer if present
+        void unregisterObserver(Observer* observer);
+
+        // Number of registered observers
+        std::size_t observerCount() const;
+
+    protected:
+        // Calls update() on every registered observer
+        void notifyObservers() const;
+
+    private:
+        mutable std::mutex mutex_;
+        std::unordered_set<Observer*> observers_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace QuantEngine {
+    // Runs fn(i) for every i in [0, count) on up to threads workers (0 = hardware concurrency)
+    // Workers claim indices one at a time and the calling thread takes part too
+    // Every index runs even if others fail; the first failure in index order is then rethrown
+    template<typename Fn>
+    void parallelFor(std::size_t count, unsigned threads, Fn&& fn) {
+        std::vector<std::exception_ptr> errors(count);
+        std::atomic<std::size_t> next{ 0 };
+        auto worker = [&]() {
+            for (std::size_t i = next++; i < count; i = next++) {
+                try {
+                    fn(i);
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        unsigned workers = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+        workers = static_cast<unsigned>(std::min<std::size_t>(workers, std::max<std::size_t>(count, 1)));
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        for (unsigned t = 1; t < workers; ++t) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& th : pool) {
+            th.join();
+        }
+
+        for (const auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/AlignedAllocator.h"
+#include "Core/Instrument.h"
+#include "Core/MarketData.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace QuantEngine {
+    // Column-oriented book of option trades
+    // Each Instrument<T>::Parameters field lives in its own cache-line aligned column,
+    // and every trade refers to one shared MarketData per underlying instead of owning a copy
+    template<typename T>
+    class Portfolio {
+    public:
+        // Aligned column type used for every per-trade field
+        template<typename U>
+        using Column = std::vector<U, AlignedAllocator<U>>;
+
+        using TradeId = std::uint64_t;
+        using UnderlyingId = std::uint32_t;
+
+        // Pre-sizes every column for n trades
+        void reserve(std::size_t n);
+
+        // Registers an underlying and the market it prices off
+        // Re-registering a known name replaces its market and returns the existing id
+        UnderlyingId addUnderlying(const std::string& name, std::shared_ptr<const MarketData<T>> market);
+
+        // Replaces the market for an underlying (e.g. on a new tick)
+        void setMarket(UnderlyingId underlying, std::shared_ptr<const MarketData<T>> market);
+
+        // Looks up an underlying by name; throws if unknown
+        UnderlyingId underlyingId(const std::string& name) const;
+
+        // Name and market of an underlying
+        const std::string& underlyingName(UnderlyingId underlying) const;
+        const MarketData<T>& market(UnderlyingId underlying) const;
+
+        // Number of registered underlyings
+        std::size_t underlyingCount() const { return names_.size(); }
+
+        // Appends a trade after the same checks as EuropeanStockOption::validate
+        // Returns the trade's row index
+        std::size_t addTrade(TradeId id, UnderlyingId underlying,
+            const typename Instrument<T>::Parameters& params);
+
+        // Reassembles the contract terms of one row
+        typename Instrument<T>::Parameters parameters(std::size_t row) const;
+
+        // Number of trades
+        std::size_t size() const { return tradeIds_.size(); }
+
+        // Drops all trades, keeping registered underlyings and column capacity
+        void clear();
+
+        // Read-only column views for batch engines
+        std::span<const T> notionals() const { return notionals_; }
+        std::span<const T> strikes() const { return strikes_; }
+        std::span<const T> maturities() const { return maturities_; }
+        std::span<const T> spots() const { return spots_; }
+        std::span<const std::uint8_t> isCall() const { return isCall_; }
+        std::span<const TradeId> tradeIds() const { return tradeIds_; }
+        std::span<const UnderlyingId> underlyings() const { return underlyings_; }
+
+        // Bytes held by the trade columns
+        std::size_t footprint() const;
+
+    private:
+        // Per-trade columns
+        Column<T> notionals_;
+        Column<T> strikes_;
+        Column<T> maturities_;
+        Column<T> spots_;
+        Column<std::uint8_t> isCall_;
+        Column<TradeId> tradeIds_;
+        Column<UnderlyingId> underlyings_;
+
+        // Per-underlying data, indexed by UnderlyingId
+        std::vector<std::string> names_;
+        std::vector<std::shared_ptr<const MarketData<T>>> markets_;
+        std::unordered_map<std::string, UnderlyingId> ids_;
+    };
+    // Instrument view of one portfolio row for engines' single-trade interfaces
+    // Engines only read getParameters(); price() and greeks() throw since a row has no engine of its own
+    template<typename T>
+    class PortfolioRow : public Instrument<T> {
+    public:
+        PortfolioRow(const Portfolio<T>& portfolio, std::size_t row) : params_(portfolio.parameters(row)) {}
+
+        // Row with explicitly given terms (e.g. a shocked spot)
+        explicit PortfolioRow(const typename Instrument<T>::Parameters& params) : params_(params) {}
+
+        T price() const override;
+        Greeks<T> greeks() const override;
+        void updateMarketData(const MarketData<T>&) override {}
+        void setPricingEngine(std::shared_ptr<PricingEngine<T>>) override {}
+        void validate() const override {}
+        const typename Instrument<T>::Parameters& getParameters() const override { return params_; }
+
+    private:
+        typename Instrument<T>::Parameters params_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/Instrument.h"
+#include "Core/MarketData.h"
+#include "Core/Portfolio.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QuantEngine {
+    // One rejected input row
+    struct LoadIssue {
+        std::size_t row;        // 1-based line for CSV, 0-based record for binary files
+        std::string message;    // Reason the row was skipped
+    };
+
+    // Outcome of a load; bad rows are collected here instead of thrown one by one
+    struct LoadReport {
+        std::size_t loaded = 0;
+        std::vector<LoadIssue> rejected;   // Sorted by row
+
+        bool ok() const { return rejected.empty(); }
+    };
+
+    // Parsed trades in file order, before any market is attached
+    template<typename T>
+    struct TradeFile {
+        std::vector<std::string> underlyings;                       // Distinct names, first-seen order
+        std::vector<std::uint64_t> tradeIds;
+        std::vector<std::uint32_t> underlyingIndex;                 // Into underlyings
+        std::vector<typename Instrument<T>::Parameters> parameters;
+        LoadReport report;
+    };
+
+    // Bulk trade reader for CSV and a compact columnar binary format
+    //
+    // CSV: optional header line, then
+    //   trade_id,underlying,notional,strike,maturity,spot,type      (type: call/put or C/P)
+    // The mapped file is cut into newline-aligned chunks that are parsed on separate threads
+    // with std::from_chars, then merged in file order
+    //
+    // Binary: 128-byte header ("QEPORTFO") followed by 64-byte aligned columns
+    //   names | trade ids | underlying ids | call flags | notionals | strikes | maturities | spots
+    // laid out like Portfolio's own columns so loading is a straight copy
+    //
+    // Rows failing the EuropeanStockOption::validate rules are reported, not thrown
+    template<typename T>
+    class PortfolioLoader {
+    public:
+        // Supplies the market for an underlying name (called once per distinct name)
+        using MarketResolver = std::function<std::shared_ptr<const MarketData<T>>(const std::string&)>;
+
+        // Parses a CSV file; threads = 0 uses hardware concurrency
+        static TradeFile<T> readCsv(const std::string& path, unsigned threads = 0);
+
+        // Parses an in-memory CSV buffer the same way
+        static TradeFile<T> parseCsv(std::string_view text, unsigned threads = 0);
+
+        // Reads a binary trade file
+        static TradeFile<T> readBinary(const std::string& path);
+
+        // Appends the parsed trades to portfolio, registering each underlying via markets
+        static void append(const TradeFile<T>& trades, Portfolio<T>& portfolio, const MarketResolver& markets);
+
+        // readCsv followed by append
+        static LoadReport loadCsv(const std::string& path, Portfolio<T>& portfolio,
+            const MarketResolver& markets, unsigned threads = 0);
+
+        // readBinary followed by append
+        static LoadReport loadBinary(const std::string& path, Portfolio<T>& portfolio, const MarketResolver& markets);
+
+        // Writes portfolio's trades in the binary format (via a temporary file and rename)
+        static void saveBinary(const Portfolio<T>& portfolio, const std::string& path);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/MappedFile.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+
+namespace QuantEngine {
+    // Append-only columnar store of daily OHLCV bars, one directory per symbol
+    // Each field lives in its own file (64-byte header, then one fixed-size value per session, oldest first),
+    // so readers map just the columns and histories grow by appending without rewriting earlier sessions
+    class PriceStore {
+    public:
+        using Clock = std::chrono::system_clock;
+
+        // Columns in file order
+        enum Column : std::uint32_t { Date, Open, High, Low, Close, Volume, ColumnCount };
+
+        // On-disk column header (native byte order)
+        struct Header {
+            char magic[8];                  // "QEPRICE1"
+            std::uint32_t version;          // Format version (see FormatVersion)
+            std::uint32_t endianTag;        // 0x01020304 as written, detects foreign byte order
+            std::uint32_t column;           // Column stored in the file
+            std::uint32_t valueSize;        // Bytes per session
+        };
+
+        static constexpr std::uint32_t FormatVersion = 1;
+        static constexpr std::size_t HeaderSize = 64;
+
+        // Daily bars to append, as columns of equal length with dates (YYYYMMDD) ascending
+        struct Bars {
+            std::span<const std::uint32_t> dates;
+            std::span<const double> opens, highs, lows, closes, volumes;
+        };
+
+        // Read-only mapped view of one symbol's history at the time it was opened
+        // Rows stop at the shortest column, so a torn append is never visible
+        class Series {
+        public:
+            std::size_t size() const { return dates_.size(); }
+            bool empty() const { return dates_.empty(); }
+
+            std::span<const std::uint32_t> dates() const { return dates_; }
+            std::span<const double> opens() const { return values_[0]; }
+            std::span<const double> highs() const { return values_[1]; }
+            std::span<const double> lows() const { return values_[2]; }
+            std::span<const double> closes() const { return values_[3]; }
+            std::span<const double> volumes() const { return values_[4]; }
+
+            // Most recent stored session, 0 when empty
+            std::uint32_t lastDate() const { return dates_.empty() ? 0 : dates_.back(); }
+
+        private:
+            friend class PriceStore;
+
+            std::array<std::shared_ptr<const MappedFile>, ColumnCount> files_;
+            std::span<const std::uint32_t> dates_;
+            std::array<std::span<const double>, ColumnCount - 1> values_;
+        };
+
+        // Keeps histories under directory (created on first append)
+        explicit PriceStore(std::filesystem::path directory);
+
+        // Mapped history of symbol; empty if nothing is stored
+        // Throws std::runtime_error on a column with the wrong magic, version, byte order or size
+        Series read(const std::string& symbol) const;
+
+        // Appends the bars dated after the last stored session and returns how many were added
+        // Throws std::invalid_argument if the columns differ in length or the dates are not ascending
+        std::size_t append(const std::string& symbol, const Bars& bars);
+
+        // Replaces symbol's whole history with bars (e.g. after downloading a longer one)
+        // On POSIX, readers holding an older Series keep their mapping; Windows cannot rename a directory
+        // with mapped files, so there the swap throws until every Series of the symbol is released
+        void replace(const std::string& symbol, const Bars& bars);
+
+        // Deletes every stored history
+        void clear();
+
+        const std::filesystem::path& directory() const { return directory_; }
+
+        // Most recent weekday whose US session had closed at now (ResponseCache::DailyCloseUtc), as YYYYMMDD
+        // Exchange holidays are not known, so a holiday counts as a session that never arrives
+        static std::uint32_t lastCompletedSession(Clock::time_point now = Clock::now());
+
+        // Weekdays after from up to and including to (valid YYYYMMDD dates); zero if to is not later
+        static std::size_t sessionsBetween(std::uint32_t from, std::uint32_t to);
+
+    private:
+        // Directory holding symbol's columns
+        std::filesystem::path symbolPath(const std::string& symbol) const;
+
+        // Writes bars[first, end) into symbol's column files in directory, creating them if needed
+        static void writeColumns(const std::filesystem::path& directory, const Bars& bars, std::size_t first);
+
+        std::filesystem::path directory_;
+        std::mutex writeMutex_;
+    };
+}
\ No newline at end of file
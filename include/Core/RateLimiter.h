@@ -0,0 +1,65 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace QuantEngine {
+    // Token bucket that paces requests to one provider below its quota
+    // Tokens refill continuously at rate per second up to burst; a request that finds the bucket empty
+    // takes a reservation on a future token instead of failing, so callers are served in arrival order
+    class RateLimiter {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        // Snapshot of the limiter's activity
+        struct Metrics {
+            std::uint64_t granted = 0;      // Tokens handed out so far
+            std::size_t queueDepth = 0;     // Reservations still waiting for their token
+            double totalWaitSeconds = 0;    // Sum of waits imposed on granted requests
+            double maxWaitSeconds = 0;      // Longest single wait
+
+            double averageWaitSeconds() const { return granted ? totalWaitSeconds / granted : 0.0; }
+        };
+
+        // Throws std::invalid_argument unless rate and burst are positive
+        RateLimiter(double ratePerSecond, double burst);
+
+        // Reserves the next token and returns when the caller may send; never blocks
+        // Suited to event loops that start a transfer once its time has come
+        Clock::time_point reserve(Clock::time_point now = Clock::now());
+
+        // Reserves a token and sleeps the calling thread until it is due; returns the time slept
+        // Blocking: under a tight quota this is a long sleep, so event loops should use reserve()
+        Clock::duration acquire();
+
+        // Wait a reservation made at now would get, without taking a token
+        Clock::duration waitEstimate(Clock::time_point now = Clock::now()) const;
+
+        // Takes a token only if one is available right now
+        bool tryAcquire(Clock::time_point now = Clock::now());
+
+        Metrics metrics(Clock::time_point now = Clock::now()) const;
+
+        double ratePerSecond() const { return rate_; }
+        double burst() const { return burst_; }
+
+    private:
+        // Tokens available at now (negative while reservations are outstanding)
+        double tokensAt(Clock::time_point now) const;
+
+        mutable std::mutex mutex_;
+        double rate_;
+        double burst_;
+        double tokens_;
+        Clock::time_point updated_;
+        Metrics metrics_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace QuantEngine {
+    // Persistent HTTP response cache, one zlib-compressed file per request
+    // Entries are keyed by the normalized URL with API keys stripped, so one download serves every key,
+    // and expire after a TTL chosen by endpoint type when they are stored
+    class ResponseCache {
+    public:
+        using Clock = std::chrono::system_clock;
+
+        // On-disk header in front of the key and the compressed body (native byte order)
+        struct Header {
+            char magic[8];                  // "QEHTTPC1"
+            std::int64_t expiresAt;         // Unix seconds after which the entry is stale
+            std::uint64_t keySize;          // Bytes of normalized key that follow the header
+            std::uint64_t bodySize;         // Uncompressed body size
+        };
+
+        // Stores entries under directory (created on first store)
+        explicit ResponseCache(std::filesystem::path directory);
+
+        // Cache key for url: scheme/host/path plus query parameters sorted by name, without apikey/api_key
+        static std::string normalize(const std::string& url);
+
+        // 64-bit FNV-1a of a normalized key, identical on every platform and standard library
+        // Names cache entries and over-long HttpTransport fixtures
+        static std::uint64_t keyHash(std::string_view key);
+
+        // Lifetime of a response fetched from url at now; zero for endpoints that are never cached
+        // Quotes: QuoteTtl; daily series: until the next US close; FRED series: RateTtl
+        static std::chrono::seconds timeToLive(const std::string& url, Clock::time_point now);
+
+        // Cached body for url if present and fresh; corrupt or stale files count as misses
+        // (including a body size the compressed bytes could not expand to)
+        std::optional<std::string> lookup(const std::string& url, Clock::time_point now = Clock::now()) const;
+
+        // Stores body for url with the endpoint's TTL; uncacheable endpoints are ignored
+        // Written via a temporary file and rename, so concurrent readers never see a partial entry
+        void store(const std::string& url, std::string_view body, Clock::time_point now = Clock::now());
+
+        // Deletes every entry
+        void clear();
+
+        const std::filesystem::path& directory() const { return directory_; }
+
+        static constexpr std::chrono::seconds QuoteTtl{ 15 };
+
+        // Upper bound on deflate's expansion of compressed bytes
+        static constexpr std::uint64_t MaxCompressionRatio = 1032;
+        static constexpr std::chrono::seconds RateTtl{ 24 * 60 * 60 };
+
+        // Daily bars are final once the US session has closed (21:00 UTC covers both EST and EDT)
+        static constexpr std::chrono::hours DailyCloseUtc{ 21 };
+
+    private:
+        // File holding the entry for a normalized key
+        std::filesystem::path entryPath(const std::string& key) const;
+
+        std::filesystem::path directory_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace QuantEngine {
+    // Streaming close-to-close volatility over one or more trailing windows of daily log returns
+    // Each close costs O(1) per window: running mean and sum of squared deviations (Welford) are
+    // updated as returns enter and leave a window, and re-derived exactly once per window length
+    // of updates to keep rounding from accumulating. Keep one estimator per symbol.
+    template<typename T>
+    class RollingVolatility {
+    public:
+        // Trading days per year used to annualize
+        static constexpr T TradingDays = T(252);
+
+        // Window lengths in returns; throws std::invalid_argument if empty or any is below 2
+        explicit RollingVolatility(std::vector<std::size_t> windows);
+
+        // Appends the next close; throws std::invalid_argument unless it is positive
+        void update(T close);
+
+        // Appends closes, oldest first
+        void update(std::span<const T> closes);
+
+        // Replaces the most recent close, e.g. with a fresher intraday print
+        // Throws std::logic_error until two closes have been seen
+        void revise(T close);
+
+        // Annualized sample volatility of the last window returns (fewer while the window fills)
+        // Throws std::invalid_argument for an untracked window and std::runtime_error below two returns
+        T volatility(std::size_t window) const;
+
+        // Volatility of the first window passed to the constructor
+        T volatility() const { return volatility(windows_.front().length); }
+
+        // Returns currently inside a window
+        std::size_t observations(std::size_t window) const;
+
+        // Closes seen since construction or reset
+        std::uint64_t closes() const { return closes_; }
+
+        // Forgets every close, keeping the windows
+        void reset();
+
+    private:
+        struct Window {
+            std::size_t length;
+            std::size_t count = 0;          // Returns inside the window
+            std::size_t sinceRefresh = 0;   // Incremental updates since the last exact pass
+            T mean = 0;
+            T m2 = 0;                       // Sum of squared deviations from mean
+        };
+
+        const Window& find(std::size_t window) const;
+
+        // Return at age positions back from the newest (0 = newest)
+        T returnAt(std::size_t age) const;
+
+        // Exact mean and m2 of the window from the stored returns
+        void refresh(Window& window) const;
+
+        std::vector<Window> windows_;
+        std::vector<T> returns_;            // Ring buffer sized to the longest window
+        std::uint64_t written_ = 0;         // Returns ever written into the ring
+        std::uint64_t closes_ = 0;
+        T lastClose_ = 0;
+        T previousClose_ = 0;
+    };
+}
\ No newline at end of file
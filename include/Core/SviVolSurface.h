@@ -0,0 +1,125 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/VolatilitySurface.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <vector>
+
+namespace QuantEngine {
+    // Raw SVI parameterisation of one maturity slice (Gatheral)
+    // Total variance w(k) = a + b * (rho * (k - m) + sqrt((k - m)^2 + sigma^2)), k = ln(K/F)
+    template<typename T>
+    struct SviParameters {
+        T a;        // Vertical level of the smile
+        T b;        // Slope of the wings
+        T rho;      // Skew / rotation, |rho| < 1
+        T m;        // Horizontal shift of the minimum
+        T sigma;    // ATM curvature, sigma > 0
+
+        // Total implied variance at log-moneyness k
+        T totalVariance(T k) const;
+
+        // Throws if the slice admits negative variance or breaches Lee's wing bound
+        void validate() const;
+    };
+
+    // Market quotes for one maturity, used to calibrate an SVI slice
+    template<typename T>
+    struct SviSliceQuotes {
+        T maturity;                 // Time to expiry (years)
+        T forward;                  // Forward price for this expiry
+        std::vector<T> strikes;     // Quoted strikes
+        std::vector<T> vols;        // Implied volatilities at those strikes
+    };
+
+    // Volatility surface built from calibrated SVI slices
+    // Evaluation is a maturity bracket search plus two SVI evaluations, no grid lookups
+    // Total variance is interpolated linearly in time at constant forward moneyness
+    template<typename T>
+    class SviVolSurface : public VolatilitySurface<T> {
+    public:
+        // Builds the surface from per-maturity parameters and forwards
+        // Throws if maturities are unsorted or any slice fails SviParameters::validate
+        SviVolSurface(std::vector<T> maturities, std::vector<T> forwards,
+            std::vector<SviParameters<T>> slices);
+
+        // Calibrates one SVI slice per maturity, running slices in parallel
+        // warmStart (optional) seeds each slice from the nearest maturity of a previous fit
+        // threads = 0 uses the hardware concurrency
+        static SviVolSurface calibrate(const std::vector<SviSliceQuotes<T>>& quotes,
+            const SviVolSurface* warmStart = nullptr, unsigned threads = 0);
+
+        // Calibrates a single slice (quasi-explicit: linear solve inside a 2-D simplex search)
+        static SviParameters<T> calibrateSlice(const SviSliceQuotes<T>& quotes,
+            const SviParameters<T>* initialGuess = nullptr);
+
+        // Implied volatility from the parametric surface
+        T volatility(T strike, T maturity) const override;
+
+        // Total implied variance at log-moneyness k and maturity
+        T totalVariance(T k, T maturity) const;
+
+        // Checks total variance is non-decreasing in maturity across the given log-moneyness grid
+        bool isCalendarArbitrageFree(const std::vector<T>& logMoneyness) const;
+
+        // Number of calibrated maturities
+        std::size_t sliceCount() const { return maturities_.size(); }
+
+        // Parameters of one slice
+        SviParameters<T> slice(std::size_t i) const;
+
+        // Forward and maturity of one slice
+        T forward(std::size_t i) const { return forwards_[i]; }
+        T maturity(std::size_t i) const { return maturities_[i]; }
+
+    private:
+        // Total variance of slice i at log-moneyness k
+        T sliceVariance(std::size_t i, T k) const;
+
+        // Lower bracketing slice for maturity, with interpolation weight and extrapolation scale
+        std::size_t locate(T maturity, T& alpha, T& scale) const;
+
+        // Slice data stored column-wise for cache-friendly evaluation
+        std::vector<T> maturities_;
+        std::vector<T> forwards_;
+        std::vector<T> logForwards_;
+        std::vector<T> a_, b_, rho_, m_, sigma_;
+    };
+
+    // Surface SVI (Gatheral-Jacquier) with power-law curvature
+    // w(k, theta) = theta/2 * (1 + rho*phi*k + sqrt((phi*k + rho)^2 + 1 - rho^2))
+    // phi(theta) = eta / (theta^gamma * (1 + theta)^(1 - gamma))
+    template<typename T>
+    class SsviVolSurface : public VolatilitySurface<T> {
+    public:
+        // Builds the surface from ATM total variances per maturity and global shape parameters
+        // Throws unless theta is non-decreasing, eta*(1+|rho|) <= 2 and 0 < gamma <= 1/2,
+        // which together rule out static (butterfly and calendar) arbitrage
+        SsviVolSurface(std::vector<T> maturities, std::vector<T> forwards,
+            std::vector<T> atmTotalVariances, T rho, T eta, T gamma);
+
+        // Implied volatility from the parametric surface
+        T volatility(T strike, T maturity) const override;
+
+        // Total implied variance at log-moneyness k and maturity
+        T totalVariance(T k, T maturity) const;
+
+    private:
+        // Interpolated ATM total variance and log-forward at maturity
+        void interpolate(T maturity, T& theta, T& logForward) const;
+
+        // SSVI total variance for log-moneyness k on the ATM variance level theta
+        T variance(T k, T theta) const;
+
+        std::vector<T> maturities_;
+        std::vector<T> logForwards_;
+        std::vector<T> thetas_;
+        T rho_;
+        T eta_;
+        T gamma_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace QuantEngine {
+    // Streaming extraction of Alpha Vantage TIME_SERIES_DAILY responses
+    // Runs nlohmann's SAX parser over the raw text and keeps only each session's "4. close"
+    // (or the full OHLCV bar on request), so no DOM is built and nothing else is copied
+    class TimeSeriesParser {
+    public:
+        // Closes of one response plus any provider refusal found at the top level
+        struct DailySeries {
+            std::vector<double> closes;         // Oldest first, at most the requested most recent sessions
+            std::vector<std::uint32_t> dates;   // Matching session dates as YYYYMMDD
+            std::vector<double> opens;          // Bar columns, filled by parseDailyBars only
+            std::vector<double> highs;
+            std::vector<double> lows;
+            std::vector<double> volumes;
+            bool hasSeries = false;             // Response carried a "Time Series (Daily)" object
+            std::string refusalKey;             // "Note", "Information", "Error Message" or "error_message"
+            std::string refusal;                // Provider's message under refusalKey
+
+            bool refused() const { return !refusalKey.empty(); }
+            bool rateLimited() const {
+                return refusalKey == "Note" && refusal.find("API call frequency") != std::string::npos;
+            }
+        };
+
+        // Parses body and keeps the most recent maxDays sessions
+        // Throws std::runtime_error on malformed JSON or an unreadable close
+        static DailySeries parseDaily(std::string_view body,
+            std::size_t maxDays = std::numeric_limits<std::size_t>::max());
+
+        // parseDaily plus the open, high, low and volume of each kept session
+        static DailySeries parseDailyBars(std::string_view body,
+            std::size_t maxDays = std::numeric_limits<std::size_t>::max());
+
+        // Scans body only for a top-level refusal (any provider response); malformed JSON counts as refused
+        static bool refused(std::string_view body);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+
+namespace QuantEngine {
+    // Base class for volatility surfaces that can replace the raw point grid in MarketData
+    // Implementations must be immutable once built so copies of MarketData can share them
+    template<typename T>
+    class VolatilitySurface {
+    public:
+        // Allows proper cleanup of derived surface objects
+        virtual ~VolatilitySurface() = default;
+
+        // Implied (Black) volatility for a strike and maturity (years)
+        virtual T volatility(T strike, T maturity) const = 0;
+
+    protected:
+        // Can only be created through derived classes
+        VolatilitySurface() = default;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+// ....
+// 3rd party headers.
+// ....
+// std headers.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <span>
+#include <vector>
+
+namespace QuantEngine {
+    // Immutable zero-rate term structure with precomputed interpolation coefficients
+    // All coefficients live in flat arrays so evaluation is a binary search plus a few flops
+    // Designed to be shared (via shared_ptr) between every MarketData copy that prices off it
+    template<typename T>
+    class YieldCurve {
+    public:
+        // Supported interpolation schemes
+        // Linear and CubicSpline interpolate zero rates, MonotoneConvex (Hagan-West) interpolates forwards
+        enum class Interpolation : std::uint8_t { Linear, CubicSpline, MonotoneConvex };
+
+        // Builds the curve from (time, zero rate) pairs, sorting them by time
+        // Throws if inputs are empty, mismatched in size, negative or contain duplicate times
+        YieldCurve(std::vector<T> times, std::vector<T> rates,
+            Interpolation method = Interpolation::MonotoneConvex);
+
+        // Continuously compounded zero rate for the given time (years)
+        // Rates are held flat outside the quoted range
+        T zeroRate(T time) const;
+
+        // Discount factor exp(-r(t) * t) evaluated straight from the coefficients
+        T discountFactor(T time) const;
+
+        // Evaluates discount factors for many times at once
+        // Sorted input is walked segment by segment instead of re-searching every point
+        void discountFactors(std::span<const T> times, std::span<T> out) const;
+
+        // Memoized discount factor lookup for repeated maturities
+        // Thread-safe; the cache is shared by every holder of this curve and bounded to DiscountCacheSlots
+        // entries (direct-mapped, so a colliding maturity simply replaces the older one)
+        T cachedDiscountFactor(T time) const;
+
+        // Entries kept by cachedDiscountFactor
+        static constexpr std::size_t DiscountCacheSlots = 256;
+
+        // Interpolation scheme the coefficients were built for
+        Interpolation interpolation() const { return method_; }
+
+        // Quoted node times and zero rates (sorted by time)
+        std::span<const T> times() const { return times_; }
+        std::span<const T> rates() const { return rates_; }
+
+    private:
+        // Index of the segment containing time, starting the search at hint
+        std::size_t findSegment(T time, std::size_t hint = 0) const;
+
+        // Integrated rate r(t) * t (= -ln DF) for a time inside segment i
+        T integratedRate(T time, std::size_t i) const;
+
+        // Coefficient builders for each interpolation scheme
+        void buildLinear();
+        void buildCubicSpline();
+        void buildMonotoneConvex();
+
+        Interpolation method_;
+
+        // Quoted curve nodes
+        std::vector<T> times_;
+        std::vector<T> rates_;
+
+        // Segment knots (times_, plus a t=0 anchor for monotone convex)
+        std::vector<T> knots_;
+
+        // Per-segment polynomial coefficients
+        // Linear/spline: r(t) = c0 + c1*dx + c2*dx^2 + c3*dx^3 with dx = t - knot
+        // Monotone convex: c0 = r*t at left knot, c1 = discrete forward, c2/c3 = g0/g1, c4 = eta
+        std::vector<T> c0_, c1_, c2_, c3_, c4_;
+
+        // Monotone convex sector (1-4) per segment, 0 when the forward is flat
+        std::vector<std::uint8_t> sector_;
+
+        // Discount factors keyed by maturity, shared across all instruments using this curve
+        // Empty slots hold a NaN time, which never matches a lookup
+        struct CacheSlot {
+            T time;
+            T discountFactor;
+        };
+        mutable std::shared_mutex cacheMutex_;
+        mutable std::array<CacheSlot, DiscountCacheSlots> discountCache_;
+    };
+}
\ No newline at end of file
@@ -4,29 +4,44 @@
 // Same project headers.
 #include "Core/Instrument.h"
 #include "Core/MarketData.h"
+#include "Core/Observable.h"
 #include "PricingEngines/PricingEngine.h"
 // 3rd party headers.
 // ....
 // std headers.
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 
 namespace QuantEngine {
 
     // Concrete implementation for European-style equity options
     // Uses the Instrument interface for pricing functionality
+    // Price and Greeks are computed lazily and cached until market data, engine or terms change
     template<typename T>
-    class EuropeanStockOption : public Instrument<T> {
+    class EuropeanStockOption : public Instrument<T>, public Observer {
     public:
         // Creates option with specific contract terms
         // Inherits parameters structure from base Instrument class
         explicit EuropeanStockOption(const typename Instrument<T>::Parameters& params);
 
+        // Same, with the market data snapshot allocated from resource (see InstrumentArena)
+        EuropeanStockOption(const typename Instrument<T>::Parameters& params, std::pmr::memory_resource* resource);
+
+        // Stops observing the pricing engine
+        ~EuropeanStockOption() override;
+
+        // Engine registration is tied to this object's address
+        EuropeanStockOption(const EuropeanStockOption&) = delete;
+        EuropeanStockOption& operator=(const EuropeanStockOption&) = delete;
+
         // ------ Mandatory Instrument implementations ------
 
-        // Calculate current option value using pricing engine
+        // Calculate current option value using pricing engine (cached until invalidated)
         T price() const override;
 
-        // Compute risk sensitivities (delta, gamma, vega, etc.)
-        std::map<std::string, T> greeks() const override;
+        // Compute risk sensitivities (delta, gamma, vega, etc.; cached until invalidated)
+        Greeks<T> greeks() const override;
 
         // Refresh market data (rates, volatilities)
         void updateMarketData(const MarketData<T>& market) override;
@@ -34,16 +49,35 @@ namespace QuantEngine {
         // Set calculation method (Monte Carlo/Analytic/etc.)
         void setPricingEngine(std::shared_ptr<PricingEngine<T>> engine) override;
 
+        // Same; with observeEngine false the option skips the engine's observer set (no registration
+        // node or lock), so engine notifications no longer drop its cached results
+        void setPricingEngine(std::shared_ptr<PricingEngine<T>> engine, bool observeEngine);
+
         // Verify contract parameters are logical/valid
         void validate() const override;
 
         // Get reference to stored contract terms
         const typename Instrument<T>::Parameters& getParameters() const override;
 
+        // Replace contract terms after validating them
+        void setParameters(const typename Instrument<T>::Parameters& params);
+
+        // Engine changed; drop cached results
+        void update() override;
+
     private:
         typename Instrument<T>::Parameters params_;  // Contract details (strike, maturity, etc.)
         std::shared_ptr<PricingEngine<T>> pricingEngine_;  // Calculation strategy
         MarketData<T> marketData_;  // Current market environment snapshot
+        bool observingEngine_ = false;  // Registered with pricingEngine_
+
+        // Drops cached results and tells this option's observers
+        void invalidate();
+
+        // Lazily filled results, guarded for concurrent const calls
+        mutable std::mutex cacheMutex_;
+        mutable std::optional<T> price_;
+        mutable std::optional<Greeks<T>> greeks_;
     };
 
 }
\ No newline at end of file
@@ -22,16 +22,19 @@ namespace QuantEngine {
         std::unique_ptr<PricingEngine<T>> clone() const override;
 
         // Computes risk sensitivities (delta, gamma, theta, vega, rho)
-        std::map<std::string, T> calculateGreeks(const Instrument<T>& instrument,
+        Greeks<T> calculateGreeks(const Instrument<T>& instrument,
             const MarketData<T>& marketData) const override;
 
+        // Streams the portfolio columns, pricing every trade against its underlying's market
+        void calculatePrices(const Portfolio<T>& portfolio, std::span<T> out) const override;
+
     private:
         // Black-Scholes intermediate calculation (d1 term)
         T d1(T S /*spot*/, T K /*strike*/, T r /*rate*/,
-            T sigma /*vol*/, T T /*time*/) const;
+            T sigma /*vol*/, T t /*time*/) const;
 
         // Black-Scholes intermediate calculation (d2 term)
-        T d2(T S, T K, T r, T sigma, T T) const;
+        T d2(T S, T K, T r, T sigma, T t) const;
 
         // Normal distribution probability (calculates theta(x))
         T N(T x) const;
@@ -0,0 +1,104 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "PricingEngines/PricingEngine.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace QuantEngine {
+    // Memoizing decorator in front of another engine
+    // Results are keyed by the contract terms (strike, maturity, spot, call/put) and MarketData::version(),
+    // so duplicate trades are priced once per market state; notional is excluded because engines
+    // return per-unit values
+    // Entries live in independently locked LRU shards bounded by a total capacity
+    template<typename T>
+    class CachedPricingEngine : public PricingEngine<T> {
+    public:
+        // Wraps inner; capacity is the maximum number of cached contracts across all shards
+        // It is split exactly between the shards, and shards beyond capacity are not created
+        explicit CachedPricingEngine(std::shared_ptr<const PricingEngine<T>> inner,
+            std::size_t capacity = 65536, std::size_t shards = 16);
+
+        // Cached per-unit price from the inner engine
+        T calculatePrice(const Instrument<T>& instrument,
+            const MarketData<T>& marketData) const override;
+
+        // Cached Greeks from the inner engine
+        Greeks<T> calculateGreeks(const Instrument<T>& instrument,
+            const MarketData<T>& marketData) const override;
+
+        // Batch pricing with one cache lookup per row, scaled by notional
+        void calculatePrices(const Portfolio<T>& portfolio, std::span<T> out) const override;
+
+        // Copy wrapping a clone of the inner engine with an empty cache of the same size
+        std::unique_ptr<PricingEngine<T>> clone() const override;
+
+        // Drops every cached entry
+        void clear();
+
+        // Lookup statistics since construction
+        std::uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+        std::uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+        // Number of cached contracts
+        std::size_t size() const;
+
+    private:
+        // Cache key: contract terms without notional plus the market state
+        struct Key {
+            T strike;
+            T maturity;
+            T spot;
+            bool isCall;
+            std::uint64_t version;
+
+            bool operator==(const Key&) const = default;
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        // Cached results; price and Greeks are filled independently on first request
+        struct Entry {
+            Key key;
+            std::optional<T> price;
+            std::optional<Greeks<T>> greeks;
+        };
+
+        // One LRU list (front = most recent) with its index and lock
+        struct Shard {
+            std::mutex mutex;
+            std::list<Entry> lru;
+            std::size_t capacity = 0;       // This shard's share of the total capacity
+            std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index;
+        };
+
+        static Key makeKey(const typename Instrument<T>::Parameters& params, const MarketData<T>& marketData);
+
+        // Shard for a key hash
+        Shard& shardFor(std::size_t hash) const;
+
+        // Finds or inserts the entry for key and moves it to the front; evicts beyond capacity
+        // Must be called with the shard locked
+        Entry& touch(Shard& shard, const Key& key) const;
+
+        std::shared_ptr<const PricingEngine<T>> inner_;
+        std::size_t capacity_;
+        std::unique_ptr<Shard[]> shards_;
+        std::size_t shardCount_;
+        mutable std::atomic<std::uint64_t> hits_{ 0 };
+        mutable std::atomic<std::uint64_t> misses_{ 0 };
+    };
+}
\ No newline at end of file
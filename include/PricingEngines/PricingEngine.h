@@ -4,16 +4,24 @@
 // Same project headers.
 #include "Core/Instrument.h"
 #include "Core/MarketData.h"
+#include "Core/Observable.h"
 // 3rd party headers.
 // ....
 // std headers.
+#include <span>
 #include <stdexcept>
 
+// Forward declare Portfolio to avoid pulling column storage into every engine
+namespace QuantEngine {
+    template<typename T> class Portfolio;
+}
+
 namespace QuantEngine {
     // Base class for all pricing calculation methods  
     // Defines interface for derivative valuation engines  
+    // Engines with settings call notifyObservers() when they change so instruments reprice  
     template<typename T>
-    class PricingEngine {
+    class PricingEngine : public Observable {
     public:
         // Allows safe deletion of derived engine objects  
         virtual ~PricingEngine() = default;
@@ -26,11 +34,18 @@ namespace QuantEngine {
         // Optional risk calculation interface  
         // Not all engines support Greek calculations  
         // Throws error by default if not implemented  
-        virtual std::map<std::string, T> calculateGreeks(const Instrument<T>& instrument,
+        virtual Greeks<T> calculateGreeks(const Instrument<T>& instrument,
             const MarketData<T>& marketData) const {
             throw std::runtime_error("Greeks calculation not implemented for this engine");
         }
 
+        // Optional batch interface over a columnar Portfolio
+        // Writes notional-scaled prices into out (one entry per trade)
+        // Throws error by default if not implemented  
+        virtual void calculatePrices(const Portfolio<T>& portfolio, std::span<T> out) const {
+            throw std::runtime_error("Batch pricing not implemented for this engine");
+        }
+
         // Creates independent copy of the pricing engine  
         // Essential for thread-safe operations and engine presets  
         virtual std::unique_ptr<PricingEngine<T>> clone() const = 0;
@@ -0,0 +1,49 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/AlignedAllocator.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace QuantEngine {
+    // Dense symmetric covariance matrix of risk-factor changes
+    // Stored row-major in cache-line aligned memory, with the row stride padded so every row starts on a line
+    template<typename T>
+    class CovarianceMatrix {
+    public:
+        explicit CovarianceMatrix(std::size_t dimension);
+
+        // Sample covariance of returns (row-major, days x factors)
+        // Columns are centred, then accumulated as X^T X in day blocks with contiguous row updates
+        static CovarianceMatrix fromReturns(std::span<const T> returns, std::size_t days, std::size_t factors);
+
+        // Factors from date-aligned histories (oldest first): daily log returns of each close series,
+        // followed by daily changes of each vol series when given
+        static CovarianceMatrix fromCloses(const std::vector<std::vector<T>>& closes,
+            const std::vector<std::vector<T>>& vols = {});
+
+        std::size_t dimension() const { return dimension_; }
+
+        T& operator()(std::size_t i, std::size_t j) { return values_[i * stride_ + j]; }
+        T operator()(std::size_t i, std::size_t j) const { return values_[i * stride_ + j]; }
+
+        // y = C x
+        void multiply(std::span<const T> x, std::span<T> y) const;
+
+        // x^T C y
+        T quadraticForm(std::span<const T> x, std::span<const T> y) const;
+
+        // Day block used by fromReturns; sized so a block of a few hundred factors stays in L2
+        static constexpr std::size_t DayBlock = 64;
+
+    private:
+        std::size_t dimension_;
+        std::size_t stride_;
+        std::vector<T, AlignedAllocator<T>> values_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Risk/CovarianceMatrix.h"
+#include "Risk/GreekAggregator.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <span>
+
+namespace QuantEngine {
+    // Moments and tail figures of the quadratic P&L approximation (VaR/ES are positive losses)
+    template<typename T>
+    struct ParametricRisk {
+        T mean = 0;
+        T standardDeviation = 0;
+        T skewness = 0;
+        T excessKurtosis = 0;
+        T valueAtRisk = 0;
+        T expectedShortfall = 0;
+    };
+
+    // Parametric delta-gamma(-vega) VaR
+    // P&L ~ a'x + x'Gx/2 for factor changes x ~ N(0, C) with diagonal G; exact cumulants of that
+    // quadratic form feed a Cornish-Fisher quantile, so no revaluation or simulation is needed
+    template<typename T>
+    class DeltaGammaVaR {
+    public:
+        // linear: P&L per unit factor change; gamma: diagonal second-order term (zero for vol factors)
+        static ParametricRisk<T> evaluate(std::span<const T> linear, std::span<const T> gamma,
+            const CovarianceMatrix<T>& covariance, T confidence = T(0.99));
+
+        // Factors are each underlying's log return (cash delta / cash gamma from report),
+        // optionally followed by each underlying's absolute vol change (vega per unit vol)
+        static ParametricRisk<T> evaluate(const GreekReport<T>& report,
+            const CovarianceMatrix<T>& covariance, T confidence = T(0.99));
+
+        // Tail levels averaged for expected shortfall
+        static constexpr int ShortfallNodes = 100;
+    };
+}
\ No newline at end of file
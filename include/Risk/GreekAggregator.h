@@ -0,0 +1,87 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/Portfolio.h"
+#include "PricingEngines/PricingEngine.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <vector>
+
+namespace QuantEngine {
+    // Notional-weighted Greek sums for one (underlying, maturity bucket) cell
+    template<typename T>
+    struct GreekTotals {
+        T delta = 0;
+        T gamma = 0;
+        T vega = 0;
+        T theta = 0;
+        T rho = 0;
+        T cashDelta = 0;          // Sum of delta * spot: P&L per unit log return
+        T cashGamma = 0;          // Sum of gamma * spot^2: second-order P&L per unit return squared
+        std::size_t trades = 0;   // Trades contributing to the cell
+
+        // Adds another cell's sums into this one
+        GreekTotals& operator+=(const GreekTotals& other);
+    };
+
+    // Aggregated risk grid, indexed by underlying id and maturity bucket
+    template<typename T>
+    class GreekReport {
+    public:
+        GreekReport(std::size_t underlyingCount, std::size_t bucketCount);
+
+        std::size_t underlyingCount() const { return underlyingCount_; }
+        std::size_t bucketCount() const { return bucketCount_; }
+
+        // Single cell; throws if out of range
+        const GreekTotals<T>& at(std::size_t underlying, std::size_t bucket) const;
+
+        // Sum over all buckets of one underlying
+        GreekTotals<T> underlyingTotal(std::size_t underlying) const;
+
+        // Sum over the whole book
+        GreekTotals<T> total() const;
+
+    private:
+        template<typename> friend class GreekAggregator;
+
+        std::size_t underlyingCount_;
+        std::size_t bucketCount_;
+        std::vector<GreekTotals<T>> cells_;  // Row-major by underlying
+    };
+
+    // Sums engine Greeks over a Portfolio, grouped by underlying and maturity bucket
+    // Rows are split into a fixed set of contiguous lanes that depends only on the book size;
+    // each lane is summed in row order into its own accumulator buffer and finished lanes are folded
+    // into a fixed pairwise tree, so results are bit-identical for any thread count
+    // Merged buffers are reused, so accumulator memory follows the worker count, not MaxLanes
+    template<typename T>
+    class GreekAggregator {
+    public:
+        // Bucket b holds maturities in (edges[b-1], edges[b]]; the last bucket is open-ended
+        // Edges must be positive and strictly increasing
+        explicit GreekAggregator(std::vector<T> bucketEdges);
+
+        // Number of maturity buckets (edges + 1)
+        std::size_t bucketCount() const { return edges_.size() + 1; }
+
+        // Bucket index for a maturity
+        std::size_t bucket(T maturity) const;
+
+        // Computes Greeks for every trade with engine.calculateGreeks and sums them
+        // Greeks are scaled by trade notional; threads = 0 uses hardware concurrency
+        // The first engine failure (in row order) is rethrown
+        GreekReport<T> aggregate(const Portfolio<T>& portfolio, const PricingEngine<T>& engine,
+            unsigned threads = 0) const;
+
+        // Lane sizing; fixed so the summation order never depends on the machine
+        static constexpr std::size_t MaxLanes = 64;
+        static constexpr std::size_t MinLaneRows = 1024;
+
+    private:
+        std::vector<T> edges_;
+    };
+}
\ No newline at end of file
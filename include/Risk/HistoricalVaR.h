@@ -0,0 +1,111 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/AlignedAllocator.h"
+#include "Core/Portfolio.h"
+#include "PricingEngines/BlackScholesEngine.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace QuantEngine {
+    // One day's market move for one underlying
+    template<typename T>
+    struct MarketMove {
+        T spotReturn = 0;   // Log return applied to spot
+        T volChange = 0;    // Absolute change added to every volatility
+        T rateChange = 0;   // Absolute change added to every rate
+    };
+
+    // Historical moves, scenario-major: one row of per-underlying moves per day
+    template<typename T>
+    class HistoricalScenarios {
+    public:
+        HistoricalScenarios(std::size_t scenarioCount, std::size_t underlyingCount);
+
+        // Scenarios from date-aligned histories (oldest first, one series per underlying id)
+        // Spot moves are daily log returns of closes; vol histories (per underlying) and the rate
+        // history are optional and turn into daily differences
+        static HistoricalScenarios fromHistory(const std::vector<std::vector<T>>& closes,
+            const std::vector<std::vector<T>>& vols = {}, const std::vector<T>& rates = {});
+
+        std::size_t scenarioCount() const { return scenarios_; }
+        std::size_t underlyingCount() const { return underlyings_; }
+
+        MarketMove<T>& move(std::size_t scenario, std::size_t underlying) { return moves_[scenario * underlyings_ + underlying]; }
+        const MarketMove<T>& move(std::size_t scenario, std::size_t underlying) const {
+            return moves_[scenario * underlyings_ + underlying];
+        }
+
+    private:
+        std::size_t scenarios_;
+        std::size_t underlyings_;
+        std::vector<MarketMove<T>> moves_;
+    };
+
+    // Scenario x trade P&L with single-precision storage
+    // Rows are cache-line aligned so each scenario streams contiguously; portfolio totals are kept in T
+    template<typename T>
+    class ScenarioPnl {
+    public:
+        ScenarioPnl(std::size_t scenarioCount, std::size_t tradeCount);
+
+        std::size_t scenarioCount() const { return scenarios_; }
+        std::size_t tradeCount() const { return trades_; }
+
+        // P&L of every trade under one scenario
+        std::span<float> row(std::size_t scenario) { return { values_.data() + scenario * stride_, trades_ }; }
+        std::span<const float> row(std::size_t scenario) const { return { values_.data() + scenario * stride_, trades_ }; }
+
+        float at(std::size_t scenario, std::size_t trade) const { return values_[scenario * stride_ + trade]; }
+
+        // Whole-portfolio P&L per scenario, summed at full precision
+        std::span<const T> totals() const { return totals_; }
+        std::span<T> totals() { return totals_; }
+
+    private:
+        std::size_t scenarios_;
+        std::size_t trades_;
+        std::size_t stride_;   // Trades rounded up to a whole cache line of floats
+        std::vector<float, AlignedAllocator<float>> values_;
+        std::vector<T> totals_;
+    };
+
+    // Tail statistics of a P&L distribution (positive numbers are losses)
+    template<typename T>
+    struct RiskMeasure {
+        T valueAtRisk = 0;
+        T expectedShortfall = 0;
+        std::size_t tailCount = 0;   // Scenarios averaged for expected shortfall
+    };
+
+    // Historical-simulation VaR / expected shortfall with full Black-Scholes revaluation
+    // Each scenario shocks every underlying's spot, vols and rates and reprices every trade
+    template<typename T>
+    class HistoricalVaR {
+    public:
+        explicit HistoricalVaR(std::shared_ptr<const BlackScholesEngine<T>> engine =
+            std::make_shared<const BlackScholesEngine<T>>());
+
+        // Revalues portfolio under every scenario in parallel (threads = 0 uses hardware concurrency)
+        // Scenario underlying columns follow the portfolio's underlying ids
+        ScenarioPnl<T> revalue(const Portfolio<T>& portfolio, const HistoricalScenarios<T>& scenarios,
+            unsigned threads = 0) const;
+
+        // VaR is the loss at the ceil(N * (1 - confidence))-th worst scenario;
+        // expected shortfall is the mean loss over those worst scenarios
+        static RiskMeasure<T> measure(std::span<const T> pnl, T confidence);
+
+        // revalue followed by measure on the portfolio totals
+        RiskMeasure<T> evaluate(const Portfolio<T>& portfolio, const HistoricalScenarios<T>& scenarios,
+            T confidence = T(0.99), unsigned threads = 0) const;
+
+    private:
+        std::shared_ptr<const BlackScholesEngine<T>> engine_;
+    };
+}
\ No newline at end of file
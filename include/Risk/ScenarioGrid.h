@@ -0,0 +1,66 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/Portfolio.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace QuantEngine {
+    // Portfolio value over a spot x vol shock grid
+    template<typename T>
+    struct ScenarioResult {
+        std::vector<T> spotShocks;
+        std::vector<T> volShocks;
+        T base = 0;              // Unshocked portfolio value
+        std::vector<T> values;   // Row-major by spot shock
+
+        // Portfolio value under spot shock i and vol shock j
+        T at(std::size_t i, std::size_t j) const { return values[i * volShocks.size() + j]; }
+
+        // Value change against the unshocked book
+        T pnl(std::size_t i, std::size_t j) const { return at(i, j) - base; }
+    };
+
+    // Black-Scholes revaluation of a Portfolio over a grid of spot and volatility shocks
+    // Spot shocks are relative (S * (1 + s)), vol shocks absolute (sigma + v) at the trade's own strike
+    // Per-trade terms (log-moneyness, sqrt(T), rT, discounted strike) are computed once and
+    // each trade then sweeps the whole grid in branch-free loops over contiguous arrays
+    template<typename T>
+    class ScenarioGrid {
+    public:
+        ScenarioGrid(std::vector<T> spotShocks, std::vector<T> volShocks);
+
+        // Evenly spaced symmetric ladder, e.g. ladder(0.10, 21, 0.05, 11) for +/-10% spot by +/-5 vol points
+        static ScenarioGrid ladder(T spotRange, std::size_t spotSteps, T volRange, std::size_t volSteps);
+
+        std::size_t spotCount() const { return spotShocks_.size(); }
+        std::size_t volCount() const { return volShocks_.size(); }
+
+        // Whole-book values over the grid; threads = 0 uses hardware concurrency
+        // Trades are split into fixed lanes and summed by a pairwise tree (thread-count independent)
+        ScenarioResult<T> revalue(const Portfolio<T>& portfolio, unsigned threads = 0) const;
+
+        // Notional-scaled value of every trade at every grid point
+        // out is trade-major: out[trade * spotCount() * volCount() + i * volCount() + j]
+        void revalueTrades(const Portfolio<T>& portfolio, std::span<T> out) const;
+
+        // Lane sizing shared with GreekAggregator's reduction scheme
+        static constexpr std::size_t MaxLanes = 64;
+        static constexpr std::size_t MinLaneRows = 256;
+
+    private:
+        // Adds trade row's notional-scaled grid values into grid (spot-major, volCount() wide)
+        // scratch holds 3 * volCount() values; returns the trade's unshocked value
+        T accumulate(const Portfolio<T>& portfolio, std::size_t row, T* grid, T* scratch) const;
+
+        std::vector<T> spotShocks_;
+        std::vector<T> volShocks_;
+        std::vector<T> logSpotShift_;   // log(1 + s) for each spot shock
+        std::vector<T> spotScale_;      // 1 + s
+    };
+}
\ No newline at end of file
@@ -86,8 +86,9 @@ int main() {
 
         // Display risk sensitivities
         std::cout << "\n=== Greeks ===" << std::endl;
-        for (const auto& [greek, value] : option->greeks()) {
-            std::cout << greek << ": " << value << std::endl;
+        const auto greeks = option->greeks();
+        for (Greek greek : AllGreeks) {
+            std::cout << greekName(greek) << ": " << greeks[greek] << std::endl;
         }
     }
     catch (const std::exception& e) {
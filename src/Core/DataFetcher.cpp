@@ -1,92 +1,491 @@
 // Same project headers.
 #include "Core/DataFetcher.h"
 #include "Core/ConfigManager.h"
+#include "Core/HttpClient.h"
+#include "Core/HttpTransport.h"
+#include "Core/MemoizedValue.h"
+#include "Core/PriceStore.h"
+#include "Core/RateLimiter.h"
+#include "Core/ResponseCache.h"
+#include "Core/RollingVolatility.h"
+#include "Core/TimeSeriesParser.h"
 // 3rd party headers.
-#include <curl/curl.h>
 #include <nlohmann/json.hpp>
 // std headers.
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <cmath>
 #include <vector>
 #include <algorithm>
-#include <chrono>
-#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 namespace QuantEngine {
     namespace {
-        // Handles incoming data from CURL requests
-        // Appends received data to the provided string buffer
-        size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::string* output) {
-            size_t totalSize = size * nmemb;
-            output->append(static_cast<char*>(contents), totalSize);
-            return totalSize;
+        // Alpha Vantage and FRED endpoints
+        std::string quoteUrl(const std::string& symbol, const std::string& apiKey) {
+            return "https://www.alphavantage.co/query?function=GLOBAL_QUOTE&symbol=" + symbol + "&apikey=" + apiKey;
+        }
+
+        std::string dailyUrl(const std::string& symbol, const std::string& apiKey, const std::string& outputSize) {
+            return "https://www.alphavantage.co/query?function=TIME_SERIES_DAILY&symbol=" +
+                symbol + "&apikey=" + apiKey + "&outputsize=" + outputSize;
+        }
+
+        std::string riskFreeRateUrl(const std::string& fredApiKey) {
+            return "https://api.stlouisfed.org/fred/series/observations?series_id=DTB3&api_key=" +
+                fredApiKey + "&file_type=json&sort_order=desc&limit=1";
         }
 
-        // Executes HTTP GET request with 10-second timeout
-        // Throws error if CURL initialization fails or request times out
-        std::string httpGet(const std::string& url) {
-            CURL* curl = curl_easy_init();
-            std::string response;
+        // Sessions behind the historical volatility estimate
+        constexpr std::size_t VolatilityWindow = 30;
+
+        // Sessions in a compact daily series; longer histories need the full download
+        constexpr std::size_t CompactSessions = 100;
+
+        // Process-wide response cache, shared by every fetch
+        std::mutex cacheMutex;
+        std::shared_ptr<ResponseCache> sharedCache =
+            std::make_shared<ResponseCache>(std::filesystem::temp_directory_path() / "quantengine_http_cache");
+
+        std::shared_ptr<ResponseCache> currentCache() {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            return sharedCache;
+        }
 
-            if (curl) {
-                // Configure CURL options
-                curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-                curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-                curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-                curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10);
+        // Process-wide daily price history, read before the provider's daily series
+        std::mutex storeMutex;
+        std::shared_ptr<PriceStore> sharedStore =
+            std::make_shared<PriceStore>(std::filesystem::temp_directory_path() / "quantengine_price_store");
+
+        std::shared_ptr<PriceStore> currentStore() {
+            std::lock_guard<std::mutex> lock(storeMutex);
+            return sharedStore;
+        }
+
+        // Per-provider pacing, keyed by the ConfigManager service name
+        // Defaults sit at the free-tier quotas: Alpha Vantage 5 requests/minute, FRED 120 requests/minute
+        std::mutex limiterMutex;
+        std::map<std::string, std::shared_ptr<RateLimiter>> limiters = {
+            { "alpha_vantage", std::make_shared<RateLimiter>(5.0 / 60.0, 1.0) },
+            { "fred", std::make_shared<RateLimiter>(2.0, 1.0) },
+        };
+
+        // Replayed fixtures never reach the provider, so they are not paced against its quota
+        std::shared_ptr<RateLimiter> limiterFor(const std::string& url) {
+            if (HttpTransport::mode() == HttpTransport::Mode::Replay) {
+                return nullptr;
+            }
+            const char* provider = url.find("alphavantage.co") != std::string::npos ? "alpha_vantage"
+                : url.find("api.stlouisfed.org") != std::string::npos ? "fred" : nullptr;
+            if (!provider) {
+                return nullptr;
+            }
+            std::lock_guard<std::mutex> lock(limiterMutex);
+            auto it = limiters.find(provider);
+            return it == limiters.end() ? nullptr : it->second;
+        }
+
+        // Session memo for the FRED rate, which changes at most once a day
+        MemoizedValue<double> riskFreeRateMemo(std::chrono::hours(1));
+
+        // Latest 3-month T-Bill rate from a FRED response
+        // Throws when the latest value is missing ("." or no observations), so no fallback is ever memoized
+        // or cached as if FRED had published it; callers apply their own default
+        double parseRiskFreeRate(const std::string& response) {
+            nlohmann::json data = nlohmann::json::parse(response);
+            if (data.contains("observations") && !data["observations"].empty()) {
+                std::string valueStr = data["observations"][0]["value"].get<std::string>();
+                if (valueStr != ".") {
+                    return std::stod(valueStr) / 100.0;  // Convert percentage to decimal
+                }
+            }
+            throw std::runtime_error("FRED response has no current T-Bill rate");
+        }
 
-                // Execute request and check for errors
-                CURLcode res = curl_easy_perform(curl);
-                if (res != CURLE_OK) {
-                    throw std::runtime_error("CURL request failed: " + std::string(curl_easy_strerror(res)));
+        // Only real data is worth keeping; throttling notes, provider errors and FRED
+        // responses without a rate must be refetched
+        bool worthCaching(const std::string& url, const std::string& body) {
+            if (url.find("api.stlouisfed.org") != std::string::npos) {
+                try {
+                    parseRiskFreeRate(body);
+                }
+                catch (const std::exception&) {
+                    return false;
                 }
+                return true;
+            }
+            return !TimeSeriesParser::refused(body);
+        }
 
-                curl_easy_cleanup(curl);
-                return response;
+        // Stores a fresh response; cache write failures never fail the fetch
+        void remember(ResponseCache* cache, const std::string& url, const std::string& body) {
+            if (!cache || !worthCaching(url, body)) {
+                return;
             }
-            else {
-                throw std::runtime_error("Failed to initialize CURL");
+            try {
+                cache->store(url, body);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Warning: Could not cache response: " << e.what() << std::endl;
             }
         }
 
-        // Computes annualized volatility from price history
-        // Uses 30-day window by default (adjustable via days parameter)
-        // Assumes 252 trading days/year for annualization
-        double calculateHistoricalVolatility(const std::vector<double>& prices, int days = 30) {
-            if (prices.size() < 2) {
+        // GET through the response cache
+        // Blocking: a network request first sleeps this thread until the provider's limiter grants a token
+        std::string cachedGet(const std::string& url) {
+            const auto cache = currentCache();
+            if (cache) {
+                if (auto body = cache->lookup(url)) {
+                    return std::move(*body);
+                }
+            }
+            if (const auto limiter = limiterFor(url)) {
+                limiter->acquire();
+            }
+            std::string body = HttpClient::get(url);
+            remember(cache.get(), url, body);
+            return body;
+        }
+
+        // Spot price from a GLOBAL_QUOTE response
+        double parseSpot(const std::string& response, const std::string& symbol) {
+            nlohmann::json data = nlohmann::json::parse(response);
+            if (!data.contains("Global Quote") || data["Global Quote"].empty()) {
+                throw std::runtime_error("Failed to fetch stock data for " + symbol);
+            }
+            return std::stod(data["Global Quote"]["05. price"].get<std::string>());
+        }
+
+        // Annualized volatility over every return in closes
+        double volatilityOfCloses(std::span<const double> closes) {
+            if (closes.size() < 3) {
                 throw std::runtime_error("Not enough price data to calculate volatility");
             }
+            RollingVolatility<double> estimator({ closes.size() - 1 });
+            estimator.update(closes);
+            return estimator.volatility();
+        }
+
+        // Volatility of the closes in a parsed TIME_SERIES_DAILY response
+        double volatilityFromSeries(const TimeSeriesParser::DailySeries& series) {
+            if (!series.hasSeries) {
+                throw std::runtime_error("Invalid response format from Alpha Vantage");
+            }
+            return volatilityOfCloses(series.closes);
+        }
+
+        // Sessions of a parsed daily series whose US close had passed (PriceStore::lastCompletedSession)
+        // Every daily path uses this cut, so the store, batch and async fetches see the same history
+        std::size_t completedSessions(const TimeSeriesParser::DailySeries& series) {
+            return static_cast<std::size_t>(std::upper_bound(series.dates.begin(), series.dates.end(),
+                PriceStore::lastCompletedSession()) - series.dates.begin());
+        }
+
+        // Closes of body's completed sessions, keeping the most recent days of them
+        // The current session's bar keeps moving until the close, so it is never used
+        TimeSeriesParser::DailySeries parseCompletedDaily(std::string_view body, std::size_t days) {
+            auto series = TimeSeriesParser::parseDaily(body);
+            const std::size_t completed = completedSessions(series);
+            const std::size_t first = completed - std::min(days, completed);
+            series.closes.erase(series.closes.begin() + completed, series.closes.end());
+            series.closes.erase(series.closes.begin(), series.closes.begin() + first);
+            series.dates.erase(series.dates.begin() + completed, series.dates.end());
+            series.dates.erase(series.dates.begin(), series.dates.begin() + first);
+            return series;
+        }
+
+        // Daily bars from the provider, retried once behind the limiter when throttled
+        TimeSeriesParser::DailySeries fetchDailyBars(const std::string& url) {
+            auto series = TimeSeriesParser::parseDailyBars(cachedGet(url));
+            if (series.rateLimited()) {
+                series = TimeSeriesParser::parseDailyBars(cachedGet(url));
+            }
+            return series;
+        }
+
+        // Most recent days closes of symbol, oldest first, served from the price store
+        // The provider is only asked when the store lacks the last completed session or enough history:
+        // the compact series tops up short gaps, the full one backfills. Completed sessions are written
+        // back; the current session's unfinished bar never is
+        // Empty if the provider refused and nothing is stored; throws on a malformed provider response
+        std::vector<double> storedCloses(PriceStore& store, const std::string& symbol, const std::string& apiKey,
+            std::size_t days) {
+            const std::uint32_t target = PriceStore::lastCompletedSession();
+            auto stored = store.read(symbol);
+            if (stored.empty() || stored.lastDate() < target || stored.size() < days) {
+                const std::size_t missing = stored.empty() ? days : PriceStore::sessionsBetween(stored.lastDate(), target);
+                const bool full = missing > CompactSessions || stored.size() + missing < days;
+                const auto series = fetchDailyBars(dailyUrl(symbol, apiKey, full ? "full" : "compact"));
+
+                if (!series.hasSeries) {
+                    if (!stored.empty() || series.refused()) {
+                        // Stale history beats none; the next call asks again
+                        const std::size_t keep = std::min(days, stored.size());
+                        return std::vector<double>(stored.closes().end() - keep, stored.closes().end());
+                    }
+                    throw std::runtime_error("Invalid response format from Alpha Vantage");
+                }
+
+                const std::size_t completed = completedSessions(series);
+                const PriceStore::Bars bars{ std::span(series.dates).first(completed),
+                    std::span(series.opens).first(completed), std::span(series.highs).first(completed),
+                    std::span(series.lows).first(completed), std::span(series.closes).first(completed),
+                    std::span(series.volumes).first(completed) };
+                try {
+                    // Unmap first: Windows cannot rename a symbol directory while its columns are mapped
+                    const bool longer = full && completed > stored.size();
+                    stored = {};
+                    if (longer) {
+                        store.replace(symbol, bars);
+                    }
+                    else {
+                        store.append(symbol, bars);
+                    }
+                    stored = store.read(symbol);
+                }
+                catch (const std::exception& e) {
+                    // A store that cannot be written never fails the fetch
+                    std::cerr << "Warning: Could not store prices for " << symbol << ": " << e.what() << std::endl;
+                    const std::size_t keep = std::min(days, completed);
+                    return std::vector<double>(series.closes.begin() + (completed - keep), series.closes.begin() + completed);
+                }
+            }
+
+            const std::size_t keep = std::min(days, stored.size());
+            return std::vector<double>(stored.closes().end() - keep, stored.closes().end());
+        }
+
+        // StockData from a symbol's quote and daily-series responses (no throttling retry)
+        // Throws if the quote has no spot price; the volatility falls back to 30%
+        DataFetcher::StockData assembleStockData(const std::string& symbol, const HttpClient::Response& quote,
+            const HttpClient::Response& daily, double riskFreeRate) {
+            if (!quote.ok()) {
+                throw std::runtime_error(quote.error);
+            }
+            DataFetcher::StockData data;
+            data.spotPrice = parseSpot(quote.body, symbol);
+
+            try {
+                if (!daily.ok()) {
+                    throw std::runtime_error(daily.error);
+                }
+                const auto series = parseCompletedDaily(daily.body, VolatilityWindow);
+                data.volatility = series.refused() ? 0.30 : volatilityFromSeries(series);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Warning: Could not calculate volatility for " << symbol << ": " << e.what() << std::endl;
+                data.volatility = 0.30; // Default
+            }
+
+            data.riskFreeRate = riskFreeRate;
+            return data;
+        }
+
+        // Small pool that finishes asynchronous fetches off the reactor thread
+        // Caching a body (refusal scan, compression, file write) and parsing it can take milliseconds for a
+        // full daily series; done here, the I/O loop keeps starting and draining other transfers meanwhile
+        class CompletionWorkers {
+        public:
+            explicit CompletionWorkers(unsigned threads) {
+                for (unsigned i = 0; i < threads; ++i) {
+                    threads_.emplace_back([this] { run(); });
+                }
+            }
 
-            // Convert prices to daily logarithmic returns
-            std::vector<double> logReturns;
-            for (size_t i = 1; i < prices.size(); ++i) {
-                double returnValue = std::log(prices[i] / prices[i - 1]);
-                logReturns.push_back(returnValue);
+            // Finishes every queued job before joining, so no promise is left unset
+            ~CompletionWorkers() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stopping_ = true;
+                }
+                ready_.notify_all();
+                for (auto& thread : threads_) {
+                    thread.join();
+                }
             }
 
-            // Calculate statistical variance of returns
-            double sum = 0.0;
-            for (double ret : logReturns) {
-                sum += ret;
+            void post(std::function<void()> job) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    jobs_.push_back(std::move(job));
+                }
+                ready_.notify_one();
             }
-            double mean = sum / logReturns.size();
 
-            double variance = 0.0;
-            for (double ret : logReturns) {
-                variance += std::pow(ret - mean, 2);
+        private:
+            void run() {
+                for (;;) {
+                    std::function<void()> job;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+                        if (jobs_.empty()) {
+                            return;
+                        }
+                        job = std::move(jobs_.front());
+                        jobs_.pop_front();
+                    }
+                    try {
+                        job();
+                    }
+                    catch (...) {
+                        // Jobs deliver their own errors through promises; the worker keeps serving
+                    }
+                }
             }
-            variance /= (logReturns.size() - 1);
 
-            // Annualize the standard deviation
-            return std::sqrt(variance * 252);
+            std::mutex mutex_;
+            std::condition_variable ready_;
+            std::deque<std::function<void()>> jobs_;
+            bool stopping_ = false;
+            std::vector<std::thread> threads_;
+        };
+
+        CompletionWorkers& completionWorkers() {
+            static CompletionWorkers instance(std::clamp(std::thread::hardware_concurrency(), 2u, 4u));
+            return instance;
+        }
+
+        // I/O thread behind the asynchronous API, started on first use
+        // Constructed after the caches, limiters and rate memo above, so it stops before they are destroyed;
+        // the completion workers are constructed first, so they outlive it and take its final error callbacks
+        HttpClient::Reactor& reactor() {
+            completionWorkers();
+            static HttpClient::Reactor instance;
+            return instance;
+        }
+
+        // Asynchronous fetches from submission until their completion job starts
+        std::atomic<std::size_t> asyncInFlight{ 0 };
+
+        // Non-blocking GET through the response cache
+        // Hits answer on the calling thread; misses run on the reactor once the provider's limiter allows,
+        // and the reactor hands the body to a completion worker, which caches it and runs done
+        void cachedGetAsync(const std::string& url, HttpClient::Reactor::Callback done) {
+            const auto cache = currentCache();
+            if (cache) {
+                if (auto body = cache->lookup(url)) {
+                    done({ std::move(*body), {} });
+                    return;
+                }
+            }
+            const auto limiter = limiterFor(url);
+            ++asyncInFlight;
+            reactor().submit(url, [cache, url, done = std::move(done)](HttpClient::Response response) mutable {
+                completionWorkers().post([cache, url, done = std::move(done), response = std::move(response)]() mutable {
+                    --asyncInFlight;
+                    if (response.ok()) {
+                        remember(cache.get(), url, response.body);
+                    }
+                    done(std::move(response));
+                });
+            }, limiter ? limiter->reserve() : HttpClient::Reactor::Clock::time_point{});
+        }
+
+        // Memoized rate without blocking: joins the running FRED request or starts the only one
+        void riskFreeRateAsync(std::string (*fredApiKey)(), MemoizedValue<double>::Callback callback) {
+            riskFreeRateMemo.getAsync(std::move(callback), [fredApiKey] {
+                cachedGetAsync(riskFreeRateUrl(fredApiKey()), [](HttpClient::Response response) {
+                    try {
+                        if (!response.ok()) {
+                            throw std::runtime_error(response.error);
+                        }
+                        riskFreeRateMemo.complete(parseRiskFreeRate(response.body));
+                    }
+                    catch (...) {
+                        riskFreeRateMemo.fail(std::current_exception());
+                    }
+                });
+            });
         }
+
+        // Sets promise to compute(), or to the exception it throws
+        template<typename R, typename F>
+        void resolve(std::promise<R>& promise, F&& compute) {
+            try {
+                promise.set_value(compute());
+            }
+            catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }
+
+        // Quote, daily series and rate of one async fetchStockData; the last part to arrive assembles the result
+        struct PendingStockData {
+            std::mutex mutex;
+            int remaining = 3;
+            std::string symbol;
+            HttpClient::Response quote, daily;
+            std::shared_future<double> rate;
+            std::promise<DataFetcher::StockData> promise;
+
+            void arrive() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (--remaining > 0) {
+                        return;
+                    }
+                }
+                resolve(promise, [this] {
+                    double riskFreeRate = 0.05;
+                    try {
+                        riskFreeRate = rate.get();
+                    }
+                    catch (const std::exception& e) {
+                        std::cerr << "Warning: Could not fetch risk-free rate: " << e.what() << std::endl;
+                    }
+                    try {
+                        return assembleStockData(symbol, quote, daily, riskFreeRate);
+                    }
+                    catch (const std::exception& e) {
+                        throw std::runtime_error("Failed to fetch stock data for " + symbol + ": " + e.what());
+                    }
+                });
+            }
+        };
     }
 
     // Initialize static API key storage (configured elsewhere)
     const std::string DataFetcher::API_KEY = "";
 
+    void DataFetcher::setResponseCache(std::shared_ptr<ResponseCache> cache) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        sharedCache = std::move(cache);
+    }
+
+    std::shared_ptr<ResponseCache> DataFetcher::responseCache() {
+        return currentCache();
+    }
+
+    void DataFetcher::setPriceStore(std::shared_ptr<PriceStore> store) {
+        std::lock_guard<std::mutex> lock(storeMutex);
+        sharedStore = std::move(store);
+    }
+
+    std::shared_ptr<PriceStore> DataFetcher::priceStore() {
+        return currentStore();
+    }
+
+    void DataFetcher::setRateLimit(const std::string& provider, double requestsPerMinute, double burst) {
+        auto limiter = std::make_shared<RateLimiter>(requestsPerMinute / 60.0, burst);
+        std::lock_guard<std::mutex> lock(limiterMutex);
+        limiters[provider] = std::move(limiter);
+    }
+
+    std::shared_ptr<RateLimiter> DataFetcher::rateLimiter(const std::string& provider) {
+        std::lock_guard<std::mutex> lock(limiterMutex);
+        auto it = limiters.find(provider);
+        return it == limiters.end() ? nullptr : it->second;
+    }
+
     // Retrieve Alpha Vantage API key from configuration
     std::string DataFetcher::getApiKey() {
         return ConfigManager::getInstance().getApiKey("alpha_vantage");
@@ -98,66 +497,68 @@ namespace QuantEngine {
     }
 
     // Get current risk-free rate from FRED's 3-month T-Bill data
-    // Uses 5% fallback if data unavailable
+    // Throws if FRED has no current value; fetchStockData falls back to 5% then
+    // Memoized for the session; concurrent callers share a single FRED request
     double DataFetcher::fetchRiskFreeRate() {
-        std::string fred_api_key = getFredApiKey();
-        std::string url = "https://api.stlouisfed.org/fred/series/observations?series_id=DTB3&api_key=" +
-            fred_api_key +
-            "&file_type=json&sort_order=desc&limit=1";
-
-        std::string response = httpGet(url);
-        nlohmann::json data = nlohmann::json::parse(response);
+        return riskFreeRateMemo.get([] {
+            return parseRiskFreeRate(cachedGet(riskFreeRateUrl(getFredApiKey())));
+        });
+    }
 
-        // Parse latest rate from JSON response
-        if (data.contains("observations") && !data["observations"].empty()) {
-            std::string valueStr = data["observations"][0]["value"].get<std::string>();
-            if (valueStr != ".") {
-                return std::stod(valueStr) / 100.0;  // Convert percentage to decimal
-            }
-        }
+    void DataFetcher::setRiskFreeRateRefresh(std::chrono::seconds maxAge) {
+        riskFreeRateMemo.setMaxAge(maxAge);
+    }
 
-        return 0.05; // Default if data missing
+    void DataFetcher::invalidateRiskFreeRate() {
+        riskFreeRateMemo.invalidate();
     }
 
-    // Fetch 30 days of price data and compute volatility
+    // Fetch the most recent 30 sessions and compute volatility
     // Implements retry logic for API rate limits
     // Uses 30% fallback if data unavailable
     double DataFetcher::fetchHistoricalVolatility(const std::string& symbol, const std::string& apiKey) {
-        std::string url = "https://www.alphavantage.co/query?function=TIME_SERIES_DAILY&symbol=" +
-            symbol + "&apikey=" + apiKey + "&outputsize=compact";
+        if (const auto store = currentStore()) {
+            const auto closes = storedCloses(*store, symbol, apiKey, VolatilityWindow);
+            return closes.empty() ? 0.30 : volatilityOfCloses(closes);
+        }
+
+        const std::string url = dailyUrl(symbol, apiKey, "compact");
 
-        std::string response = httpGet(url);
-        nlohmann::json data = nlohmann::json::parse(response);
+        auto series = parseCompletedDaily(cachedGet(url), VolatilityWindow);
 
-        // Handle API rate limiting
-        if (data.contains("Note") || data.contains("Error Message")) {
-            if (data.contains("Note") && data["Note"].get<std::string>().find("API call frequency") != std::string::npos) {
-                std::this_thread::sleep_for(std::chrono::seconds(15));  // Wait before retry
-                response = httpGet(url);
-                data = nlohmann::json::parse(response);
+        // Handle API rate limiting; the retry queues behind the provider's limiter
+        if (series.refused()) {
+            if (series.rateLimited()) {
+                series = parseCompletedDaily(cachedGet(url), VolatilityWindow);
             }
 
-            if (data.contains("Note") || data.contains("Error Message")) {
+            if (series.refused()) {
                 return 0.30; // Default volatility
             }
         }
 
-        // Extract closing prices from JSON response
-        if (!data.contains("Time Series (Daily)")) {
-            throw std::runtime_error("Invalid response format from Alpha Vantage");
+        return volatilityFromSeries(series);
+    }
+
+    // Fetch daily closes for historical simulation
+    // Closes are streamed out of the response, so even full histories never build a DOM
+    std::vector<double> DataFetcher::fetchHistoricalPrices(const std::string& symbol, const std::string& apiKey,
+        std::size_t days) {
+        if (const auto store = currentStore()) {
+            auto closes = storedCloses(*store, symbol, apiKey, days);
+            if (closes.empty()) {
+                throw std::runtime_error("Invalid response format from Alpha Vantage");
+            }
+            return closes;
         }
 
-        auto timeSeries = data["Time Series (Daily)"];
-        std::vector<double> closingPrices;
-        int count = 0;
+        std::string url = dailyUrl(symbol, apiKey, days > CompactSessions ? "full" : "compact");
 
-        // Collect most recent 30 closing prices
-        for (auto it = timeSeries.begin(); it != timeSeries.end() && count < 30; ++it, ++count) {
-            double closePrice = std::stod(it.value()["4. close"].get<std::string>());
-            closingPrices.push_back(closePrice);
+        auto series = parseCompletedDaily(cachedGet(url), days);
+        if (!series.hasSeries) {
+            throw std::runtime_error("Invalid response format from Alpha Vantage");
         }
-
-        return calculateHistoricalVolatility(closingPrices);
+        return std::move(series.closes);
     }
 
     // Main data aggregation method
@@ -168,17 +569,7 @@ namespace QuantEngine {
         StockData result;
 
         // Get real-time price
-        std::string url = "https://www.alphavantage.co/query?function=GLOBAL_QUOTE&symbol=" +
-            symbol + "&apikey=" + apiKey;
-
-        std::string response = httpGet(url);
-        nlohmann::json data = nlohmann::json::parse(response);
-
-        if (!data.contains("Global Quote") || data["Global Quote"].empty()) {
-            throw std::runtime_error("Failed to fetch stock data for " + symbol);
-        }
-
-        result.spotPrice = std::stod(data["Global Quote"]["05. price"].get<std::string>());
+        result.spotPrice = parseSpot(cachedGet(quoteUrl(symbol, apiKey)), symbol);
 
         // Get volatility with fallback
         try {
@@ -200,4 +591,151 @@ namespace QuantEngine {
 
         return result;
     }
+
+    // Batch refresh: every request for the watchlist goes out together through the multi interface
+    // Fallbacks match the single-symbol path; a symbol without a spot price is reported and left empty
+    std::vector<std::optional<DataFetcher::StockData>> DataFetcher::fetchStockData(
+        std::span<const std::string> symbols, std::size_t maxConcurrent) {
+        const std::string apiKey = getApiKey();
+
+        // Memoized rate resolves asynchronously alongside the batch (one FRED request at most, shared with other callers)
+        auto rate = fetchRiskFreeRateAsync();
+
+        // Layout: quote and daily series per symbol
+        std::vector<std::string> urls;
+        urls.reserve(2 * symbols.size());
+        for (const auto& symbol : symbols) {
+            urls.push_back(quoteUrl(symbol, apiKey));
+            urls.push_back(dailyUrl(symbol, apiKey, "compact"));
+        }
+
+        // Serve what the cache can, then fetch only the misses
+        const auto cache = currentCache();
+        std::vector<HttpClient::Response> responses(urls.size());
+        std::vector<std::string> missing;
+        std::vector<std::size_t> missingIndex;
+        for (std::size_t i = 0; i < urls.size(); ++i) {
+            auto body = cache ? cache->lookup(urls[i]) : std::nullopt;
+            if (body) {
+                responses[i].body = std::move(*body);
+            }
+            else {
+                missing.push_back(urls[i]);
+                missingIndex.push_back(i);
+            }
+        }
+        auto fetched = HttpClient::getAll(missing, maxConcurrent, [&missing](std::size_t i) {
+            const auto limiter = limiterFor(missing[i]);
+            return limiter ? limiter->reserve() : RateLimiter::Clock::now();
+        });
+        for (std::size_t m = 0; m < fetched.size(); ++m) {
+            if (fetched[m].ok()) {
+                remember(cache.get(), missing[m], fetched[m].body);
+            }
+            responses[missingIndex[m]] = std::move(fetched[m]);
+        }
+
+        // Risk-free rate with fallback
+        double riskFreeRate = 0.05;
+        try {
+            riskFreeRate = rate.get();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Warning: Could not fetch risk-free rate: " << e.what() << std::endl;
+        }
+
+        std::vector<std::optional<StockData>> results(symbols.size());
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            const auto& quote = responses[2 * i];
+            const auto& daily = responses[2 * i + 1];
+
+            try {
+                results[i] = assembleStockData(symbols[i], quote, daily, riskFreeRate);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Warning: Could not fetch stock data for " << symbols[i] << ": " << e.what() << std::endl;
+            }
+        }
+        return results;
+    }
+
+    // ----- Asynchronous API -----
+
+    std::future<double> DataFetcher::fetchRiskFreeRateAsync() {
+        auto promise = std::make_shared<std::promise<double>>();
+        auto future = promise->get_future();
+        riskFreeRateAsync(&DataFetcher::getFredApiKey, [promise](std::shared_future<double> rate) {
+            resolve(*promise, [&rate] { return rate.get(); });
+        });
+        return future;
+    }
+
+    std::future<double> DataFetcher::fetchHistoricalVolatilityAsync(const std::string& symbol, const std::string& apiKey) {
+        auto promise = std::make_shared<std::promise<double>>();
+        auto future = promise->get_future();
+        cachedGetAsync(dailyUrl(symbol, apiKey, "compact"), [promise](HttpClient::Response response) {
+            resolve(*promise, [&response] {
+                if (!response.ok()) {
+                    throw std::runtime_error("CURL request failed: " + response.error);
+                }
+                const auto series = parseCompletedDaily(response.body, VolatilityWindow);
+                return series.refused() ? 0.30 : volatilityFromSeries(series);
+            });
+        });
+        return future;
+    }
+
+    std::future<std::vector<double>> DataFetcher::fetchHistoricalPricesAsync(const std::string& symbol,
+        const std::string& apiKey, std::size_t days) {
+        auto promise = std::make_shared<std::promise<std::vector<double>>>();
+        auto future = promise->get_future();
+        cachedGetAsync(dailyUrl(symbol, apiKey, days > CompactSessions ? "full" : "compact"), [promise, days](HttpClient::Response response) {
+            resolve(*promise, [&response, days] {
+                if (!response.ok()) {
+                    throw std::runtime_error("CURL request failed: " + response.error);
+                }
+                auto series = parseCompletedDaily(response.body, days);
+                if (!series.hasSeries) {
+                    throw std::runtime_error("Invalid response format from Alpha Vantage");
+                }
+                return std::move(series.closes);
+            });
+        });
+        return future;
+    }
+
+    std::future<DataFetcher::StockData> DataFetcher::fetchStockDataAsync(const std::string& symbol) {
+        const std::string apiKey = getApiKey();
+
+        auto pending = std::make_shared<PendingStockData>();
+        pending->symbol = symbol;
+        auto future = pending->promise.get_future();
+
+        cachedGetAsync(quoteUrl(symbol, apiKey), [pending](HttpClient::Response response) {
+            {
+                std::lock_guard<std::mutex> lock(pending->mutex);
+                pending->quote = std::move(response);
+            }
+            pending->arrive();
+        });
+        cachedGetAsync(dailyUrl(symbol, apiKey, "compact"), [pending](HttpClient::Response response) {
+            {
+                std::lock_guard<std::mutex> lock(pending->mutex);
+                pending->daily = std::move(response);
+            }
+            pending->arrive();
+        });
+        riskFreeRateAsync(&DataFetcher::getFredApiKey, [pending](std::shared_future<double> rate) {
+            {
+                std::lock_guard<std::mutex> lock(pending->mutex);
+                pending->rate = std::move(rate);
+            }
+            pending->arrive();
+        });
+        return future;
+    }
+
+    std::size_t DataFetcher::pendingAsyncRequests() {
+        return asyncInFlight.load();
+    }
 } // namespace QuantEngine
\ No newline at end of file
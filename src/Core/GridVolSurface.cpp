@@ -0,0 +1,185 @@
+// Same project headers.
+#include "Core/GridVolSurface.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace QuantEngine {
+    template<typename T, typename Storage>
+    GridVolSurface<T, Storage>::GridVolSurface(std::span<const Axis> strikes, std::span<const Axis> maturities,
+        std::span<const Storage> volatilities, std::shared_ptr<const void> owner, double scale, double offset)
+        : strikes_(strikes), maturities_(maturities), vols_(volatilities), owner_(std::move(owner)),
+        scale_(scale), offset_(offset) {
+        if (vols_.size() != strikes_.size() * maturities_.size()) {
+            throw std::invalid_argument("Volatility grid size does not match its axes");
+        }
+    }
+
+    template<typename T, typename Storage>
+    std::shared_ptr<const GridVolSurface<T, Storage>> GridVolSurface<T, Storage>::compress(
+        std::span<const T> strikes, std::span<const T> maturities, std::span<const T> volatilities) {
+        if (volatilities.size() != strikes.size() * maturities.size()) {
+            throw std::invalid_argument("Volatility grid size does not match its axes");
+        }
+
+        // Encoded copies live in one block that the surface co-owns
+        struct Block {
+            std::vector<Axis> strikes;
+            std::vector<Axis> maturities;
+            std::vector<Storage> nodes;
+        };
+        auto block = std::make_shared<Block>();
+        block->strikes.assign(strikes.begin(), strikes.end());
+        block->maturities.assign(maturities.begin(), maturities.end());
+        block->nodes.resize(volatilities.size());
+
+        double scale = 1.0, offset = 0.0;
+        if constexpr (std::is_integral_v<Storage>) {
+            // Map [min, max] onto [-32767, 32767], keeping -32768 for missing nodes
+            double lo = std::numeric_limits<double>::infinity(), hi = -lo;
+            for (T v : volatilities) {
+                if (!std::isnan(v)) {
+                    lo = std::min(lo, static_cast<double>(v));
+                    hi = std::max(hi, static_cast<double>(v));
+                }
+            }
+            if (lo <= hi) {
+                scale = hi > lo ? (hi - lo) / 65534.0 : 1.0;
+                offset = lo + 32767.0 * scale;
+            }
+            for (std::size_t n = 0; n < volatilities.size(); ++n) {
+                block->nodes[n] = std::isnan(volatilities[n]) ? MissingNode
+                    : static_cast<Storage>(std::lround((volatilities[n] - offset) / scale));
+            }
+        }
+        else {
+            // Narrowing cast keeps NaN as the missing marker
+            std::transform(volatilities.begin(), volatilities.end(), block->nodes.begin(),
+                [](T v) { return static_cast<Storage>(v); });
+        }
+
+        const Block& data = *block;
+        return std::make_shared<const GridVolSurface>(std::span<const Axis>(data.strikes),
+            std::span<const Axis>(data.maturities), std::span<const Storage>(data.nodes),
+            std::move(block), scale, offset);
+    }
+
+    template<typename T, typename Storage>
+    double GridVolSurface<T, Storage>::nodeVolatility(std::size_t i, std::size_t j) const {
+        const Storage raw = vols_[i * maturities_.size() + j];
+        if constexpr (std::is_integral_v<Storage>) {
+            return raw == MissingNode ? std::numeric_limits<double>::quiet_NaN()
+                : offset_ + scale_ * static_cast<double>(raw);
+        }
+        else {
+            return offset_ + scale_ * static_cast<double>(raw);
+        }
+    }
+
+    template<typename T, typename Storage>
+    double GridVolSurface<T, Storage>::maxEncodingError() const {
+        if constexpr (std::is_integral_v<Storage>) {
+            return scale_ / 2;
+        }
+        else {
+            // Half an ulp at the largest node
+            double largest = 0.0;
+            for (std::size_t n = 0; n < vols_.size(); ++n) {
+                if (!std::isnan(static_cast<double>(vols_[n]))) {
+                    largest = std::max(largest, std::abs(static_cast<double>(vols_[n])));
+                }
+            }
+            return largest * std::numeric_limits<Storage>::epsilon() / 2;
+        }
+    }
+
+    template<typename T, typename Storage>
+    std::size_t GridVolSurface<T, Storage>::footprint() const {
+        return (strikes_.size() + maturities_.size()) * sizeof(Axis) + vols_.size() * sizeof(Storage);
+    }
+
+    template<typename T, typename Storage>
+    double GridVolSurface<T, Storage>::node(std::size_t i, std::size_t j) const {
+        const double v = nodeVolatility(i, j);
+        if (std::isnan(v)) {
+            std::stringstream ss;
+            ss << "Missing volatility point at (K=" << strikes_[i] << ", T=" << maturities_[j] << ")";
+            throw std::runtime_error(ss.str());
+        }
+        return v;
+    }
+
+    template<typename T, typename Storage>
+    T GridVolSurface<T, Storage>::volatility(T strike, T maturity) const {
+        // Queries are rounded to the axis precision first, so a request on a node that a float axis
+        // could not store exactly (e.g. 0.1) still lands on that node instead of just outside the grid
+        // All comparisons and weights are then evaluated in double
+        const double k = static_cast<Axis>(strike), t = static_cast<Axis>(maturity);
+        auto axisLess = [](Axis a, double v) { return static_cast<double>(a) < v; };
+
+        // Locate the first axis entries not below the request
+        const std::size_t ki = static_cast<std::size_t>(
+            std::lower_bound(strikes_.begin(), strikes_.end(), k, axisLess) - strikes_.begin());
+        const std::size_t ti = static_cast<std::size_t>(
+            std::lower_bound(maturities_.begin(), maturities_.end(), t, axisLess) - maturities_.begin());
+        const bool onStrike = ki < strikes_.size() && static_cast<double>(strikes_[ki]) == k;
+        const bool onMaturity = ti < maturities_.size() && static_cast<double>(maturities_[ti]) == t;
+
+        // Exact node match
+        if (onStrike && onMaturity && !std::isnan(nodeVolatility(ki, ti))) {
+            return static_cast<T>(nodeVolatility(ki, ti));
+        }
+
+        // Single-point surface is flat everywhere
+        if (strikes_.size() == 1 && maturities_.size() == 1) {
+            return static_cast<T>(node(0, 0));
+        }
+
+        // Validate surface state for interpolation
+        if (strikes_.empty() || maturities_.empty()) {
+            throw std::runtime_error("Volatility surface not initialized");
+        }
+        if (strikes_.size() < 2 || maturities_.size() < 2) {
+            throw std::runtime_error("Insufficient data for interpolation");
+        }
+        if (k < strikes_.front() || k > strikes_.back()) {
+            throw std::runtime_error("Strike out of bounds");
+        }
+        if (t < maturities_.front() || t > maturities_.back()) {
+            throw std::runtime_error("Maturity out of bounds");
+        }
+
+        // Bracketing indices (collapse to one node when sitting on an axis value)
+        const std::size_t k1 = ki, k0 = onStrike ? ki : ki - 1;
+        const std::size_t t1 = ti, t0 = onMaturity ? ti : ti - 1;
+
+        // Interpolation weights (zero when the bracket collapses)
+        const double x = (k1 == k0) ? 0.0
+            : (k - strikes_[k0]) / (static_cast<double>(strikes_[k1]) - strikes_[k0]);
+        const double y = (t1 == t0) ? 0.0
+            : (t - maturities_[t0]) / (static_cast<double>(maturities_[t1]) - maturities_[t0]);
+
+        // Fetch only the nodes that carry weight
+        const double v00 = node(k0, t0);
+        const double v01 = (t1 == t0) ? v00 : node(k0, t1);
+        const double v10 = (k1 == k0) ? v00 : node(k1, t0);
+        const double v11 = (k1 == k0) ? v01 : (t1 == t0) ? v10 : node(k1, t1);
+
+        // Bilinear interpolation
+        return static_cast<T>((1 - x) * (1 - y) * v00 + (1 - x) * y * v01 + x * (1 - y) * v10 + x * y * v11);
+    }
+
+    // Explicit template instantiation prevents linker errors
+    // Full precision grids (snapshot views) and the compact storage modes
+    template class GridVolSurface<double>;
+    template class GridVolSurface<float>;
+    template class GridVolSurface<double, float>;
+    template class GridVolSurface<double, std::int16_t>;
+    template class GridVolSurface<float, std::int16_t>;
+}
\ No newline at end of file
@@ -0,0 +1,556 @@
+// Same project headers.
+#include "Core/HttpClient.h"
+#include "Core/HttpTransport.h"
+// 3rd party headers.
+#include <curl/curl.h>
+// std headers.
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+namespace QuantEngine {
+    namespace {
+        std::atomic<std::size_t> handleCounter{ 0 };
+
+        // Process-wide libcurl state: global init plus the DNS/TLS share object
+        // Constructed before the first thread handle, so it outlives every one of them
+        class CurlShare {
+        public:
+            CurlShare() {
+                if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK) {
+                    throw std::runtime_error("Failed to initialize CURL");
+                }
+                share_ = curl_share_init();
+                if (!share_) {
+                    curl_global_cleanup();
+                    throw std::runtime_error("Failed to initialize CURL share");
+                }
+                curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, lock);
+                curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, unlock);
+                curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+                curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+            }
+
+            ~CurlShare() {
+                curl_share_cleanup(share_);
+                curl_global_cleanup();
+            }
+
+            CurlShare(const CurlShare&) = delete;
+            CurlShare& operator=(const CurlShare&) = delete;
+
+            CURLSH* handle() const { return share_; }
+
+            static CurlShare& instance() {
+                static CurlShare share;
+                return share;
+            }
+
+        private:
+            // One mutex per shared data kind, as handed to the callbacks by libcurl
+            static void lock(CURL*, curl_lock_data data, curl_lock_access, void* user) {
+                static_cast<CurlShare*>(user)->locks_[data].lock();
+            }
+            static void unlock(CURL*, curl_lock_data data, void* user) {
+                static_cast<CurlShare*>(user)->locks_[data].unlock();
+            }
+
+            CURLSH* share_ = nullptr;
+            std::mutex locks_[CURL_LOCK_DATA_LAST];
+        };
+
+        // Owning wrapper for one thread's easy handle
+        class EasyHandle {
+        public:
+            EasyHandle() {
+                CURLSH* share = CurlShare::instance().handle();
+                curl_ = curl_easy_init();
+                if (!curl_) {
+                    throw std::runtime_error("Failed to initialize CURL");
+                }
+                curl_easy_setopt(curl_, CURLOPT_SHARE, share);
+                curl_easy_setopt(curl_, CURLOPT_NOSIGNAL, 1L);
+                curl_easy_setopt(curl_, CURLOPT_TCP_KEEPALIVE, 1L);
+                curl_easy_setopt(curl_, CURLOPT_ACCEPT_ENCODING, "");
+                curl_easy_setopt(curl_, CURLOPT_TIMEOUT, HttpClient::TimeoutSeconds);
+                curl_easy_setopt(curl_, CURLOPT_CONNECTTIMEOUT, HttpClient::ConnectTimeoutSeconds);
+                curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, write);
+                ++handleCounter;
+            }
+
+            ~EasyHandle() { curl_easy_cleanup(curl_); }
+
+            EasyHandle(const EasyHandle&) = delete;
+            EasyHandle& operator=(const EasyHandle&) = delete;
+
+            CURL* get() const { return curl_; }
+
+            // Appends received data to the std::string passed as CURLOPT_WRITEDATA
+            static size_t write(void* contents, size_t size, size_t nmemb, void* output) {
+                static_cast<std::string*>(output)->append(static_cast<char*>(contents), size * nmemb);
+                return size * nmemb;
+            }
+
+        private:
+            CURL* curl_ = nullptr;
+        };
+
+        // One thread's multi handle plus the easy handles it drives
+        // Kept alive between batches so their connections stay open
+        class MultiHandle {
+        public:
+            MultiHandle() {
+                CurlShare::instance();
+                multi_ = curl_multi_init();
+                if (!multi_) {
+                    throw std::runtime_error("Failed to initialize CURL multi");
+                }
+            }
+
+            ~MultiHandle() {
+                pool_.clear();
+                curl_multi_cleanup(multi_);
+            }
+
+            MultiHandle(const MultiHandle&) = delete;
+            MultiHandle& operator=(const MultiHandle&) = delete;
+
+            CURLM* get() const { return multi_; }
+
+            // Grows the easy handle pool to at least n and returns it
+            std::vector<std::unique_ptr<EasyHandle>>& pool(std::size_t n) {
+                while (pool_.size() < n) {
+                    pool_.push_back(std::make_unique<EasyHandle>());
+                }
+                return pool_;
+            }
+
+        private:
+            CURLM* multi_ = nullptr;
+            std::vector<std::unique_ptr<EasyHandle>> pool_;
+        };
+    }
+
+    namespace {
+        // Fixture body for url, or a failed transfer naming the missing fixture
+        HttpClient::Response replayed(const std::string& url) {
+            if (auto body = HttpTransport::replay(url)) {
+                return { std::move(*body), {} };
+            }
+            return { {}, "No recorded response: " +
+                HttpTransport::fixturePath(HttpTransport::settings().fixtures, url).filename().string() };
+        }
+
+        // Saves a live body as a fixture; a failed save never fails the request
+        void recordQuietly(const std::string& url, const std::string& body) {
+            try {
+                HttpTransport::record(url, body);
+            }
+            catch (const std::exception&) {
+                // Recording is best effort
+            }
+        }
+
+        // Batch replay: transfers occupy one of maxConcurrent slots for a simulated latency each,
+        // honouring the schedule, and the call returns when the last one would have finished
+        std::vector<HttpClient::Response> replayAll(std::span<const std::string> urls, std::size_t maxConcurrent,
+            const HttpClient::Schedule& schedule) {
+            using Clock = std::chrono::steady_clock;
+            std::vector<HttpClient::Response> results(urls.size());
+            std::priority_queue<Clock::time_point, std::vector<Clock::time_point>, std::greater<>> busyUntil;
+            Clock::time_point last = Clock::now();
+            for (std::size_t i = 0; i < urls.size(); ++i) {
+                Clock::time_point start = schedule ? schedule(i) : Clock::now();
+                if (busyUntil.size() == maxConcurrent) {
+                    start = std::max(start, busyUntil.top());
+                    busyUntil.pop();
+                }
+                const auto done = start + HttpTransport::nextLatency();
+                busyUntil.push(done);
+                last = std::max(last, done);
+                results[i] = replayed(urls[i]);
+            }
+            std::this_thread::sleep_until(last);
+            return results;
+        }
+    }
+
+    std::string HttpClient::get(const std::string& url) {
+        const auto mode = HttpTransport::mode();
+        if (mode == HttpTransport::Mode::Replay) {
+            std::this_thread::sleep_for(HttpTransport::nextLatency());
+            auto response = replayed(url);
+            if (!response.ok()) {
+                throw std::runtime_error("CURL request failed: " + response.error);
+            }
+            return std::move(response.body);
+        }
+
+        // Created on the thread's first request and cleaned up when the thread exits
+        thread_local EasyHandle handle;
+
+        std::string response;
+        curl_easy_setopt(handle.get(), CURLOPT_URL, url.c_str());
+        curl_easy_setopt(handle.get(), CURLOPT_WRITEDATA, &response);
+        const CURLcode res = curl_easy_perform(handle.get());
+
+        // Don't leave the handle pointing at this frame's buffer
+        curl_easy_setopt(handle.get(), CURLOPT_WRITEDATA, nullptr);
+        if (res != CURLE_OK) {
+            throw std::runtime_error("CURL request failed: " + std::string(curl_easy_strerror(res)));
+        }
+        if (mode == HttpTransport::Mode::Record) {
+            recordQuietly(url, response);
+        }
+        return response;
+    }
+
+    std::vector<HttpClient::Response> HttpClient::getAll(std::span<const std::string> urls, std::size_t maxConcurrent,
+        const Schedule& schedule) {
+        if (maxConcurrent == 0) {
+            throw std::invalid_argument("Concurrency limit must be positive");
+        }
+
+        const auto mode = HttpTransport::mode();
+        if (mode == HttpTransport::Mode::Replay) {
+            return replayAll(urls, maxConcurrent, schedule);
+        }
+
+        thread_local MultiHandle multi;
+        std::vector<Response> results(urls.size());
+        const std::size_t slots = std::min(maxConcurrent, urls.size());
+        auto& pool = multi.pool(slots);
+
+        // Slot bookkeeping: which url each pooled handle is fetching, and which handles are free
+        std::vector<std::size_t> slotUrl(slots);
+        std::vector<std::size_t> idle(slots);
+        for (std::size_t s = 0; s < slots; ++s) {
+            idle[s] = slots - 1 - s;
+        }
+        std::vector<bool> active(slots, false);
+
+        // Detaches in-flight handles if we leave early, so the thread's multi handle stays reusable
+        struct Detach {
+            MultiHandle& multi;
+            std::vector<std::unique_ptr<EasyHandle>>& pool;
+            std::vector<bool>& active;
+            ~Detach() {
+                for (std::size_t s = 0; s < active.size(); ++s) {
+                    if (active[s]) curl_multi_remove_handle(multi.get(), pool[s]->get());
+                }
+            }
+        } detach{ multi, pool, active };
+
+        std::size_t next = 0, running = 0;
+        std::optional<std::chrono::steady_clock::time_point> nextStart;
+        while (next < urls.size() || running > 0) {
+            // Top up the in-flight set with transfers whose start time has come
+            bool held = false;
+            while (!idle.empty() && next < urls.size()) {
+                if (schedule) {
+                    if (!nextStart) {
+                        nextStart = schedule(next);
+                    }
+                    if (*nextStart > std::chrono::steady_clock::now()) {
+                        held = true;
+                        break;
+                    }
+                    nextStart.reset();
+                }
+                const std::size_t slot = idle.back();
+                CURL* curl = pool[slot]->get();
+                curl_easy_setopt(curl, CURLOPT_URL, urls[next].c_str());
+                curl_easy_setopt(curl, CURLOPT_WRITEDATA, &results[next].body);
+                curl_easy_setopt(curl, CURLOPT_PRIVATE, reinterpret_cast<void*>(static_cast<std::uintptr_t>(slot)));
+                if (curl_multi_add_handle(multi.get(), curl) != CURLM_OK) {
+                    throw std::runtime_error("Failed to queue CURL transfer: " + urls[next]);
+                }
+                idle.pop_back();
+                active[slot] = true;
+                slotUrl[slot] = next++;
+                ++running;
+            }
+
+            // Drive every transfer as far as it can go without blocking
+            int stillRunning = 0;
+            const CURLMcode rc = curl_multi_perform(multi.get(), &stillRunning);
+            if (rc != CURLM_OK) {
+                throw std::runtime_error("CURL multi failed: " + std::string(curl_multi_strerror(rc)));
+            }
+
+            // Collect finished transfers and free their slots
+            bool finished = false;
+            int queued = 0;
+            while (CURLMsg* message = curl_multi_info_read(multi.get(), &queued)) {
+                if (message->msg != CURLMSG_DONE) {
+                    continue;
+                }
+                void* privateData = nullptr;
+                curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &privateData);
+                const auto slot = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(privateData));
+                const CURLcode result = message->data.result;
+                curl_multi_remove_handle(multi.get(), message->easy_handle);
+                curl_easy_setopt(message->easy_handle, CURLOPT_WRITEDATA, nullptr);
+
+                if (result != CURLE_OK) {
+                    Response& failed = results[slotUrl[slot]];
+                    failed.body.clear();
+                    failed.error = curl_easy_strerror(result);
+                }
+                active[slot] = false;
+                idle.push_back(slot);
+                --running;
+                finished = true;
+            }
+
+            // Sleep until there is socket activity or the held transfer is due,
+            // unless freed slots have queued work to start
+            if (held || (running > 0 && !(finished && next < urls.size()))) {
+                int timeoutMs = 1000;
+                if (held) {
+                    const auto due = std::chrono::ceil<std::chrono::milliseconds>(
+                        *nextStart - std::chrono::steady_clock::now()).count();
+                    timeoutMs = static_cast<int>(std::clamp<long long>(due, 0, 1000));
+                }
+                curl_multi_poll(multi.get(), nullptr, 0, timeoutMs, nullptr);
+            }
+        }
+
+        if (mode == HttpTransport::Mode::Record) {
+            for (std::size_t i = 0; i < urls.size(); ++i) {
+                if (results[i].ok()) recordQuietly(urls[i], results[i].body);
+            }
+        }
+        return results;
+    }
+
+    std::size_t HttpClient::handlesCreated() {
+        return handleCounter.load();
+    }
+
+    // Shared between submitters and the reactor thread
+    struct HttpClient::Reactor::State {
+        struct Request {
+            std::string url;
+            Callback done;
+            Clock::time_point notBefore;
+            std::string body;
+            bool replay = false;        // Served from a fixture once due, without a transfer
+            bool record = false;        // Body saved as a fixture on success
+        };
+
+        std::size_t maxConcurrent;
+        CURLM* multi = nullptr;
+        mutable std::mutex mutex;
+        std::deque<std::unique_ptr<Request>> submitted;     // Handed over by submit(), drained by the loop
+        bool stopping = false;
+        std::atomic<std::size_t> pending{ 0 };
+
+        // Marks the request complete and runs its callback
+        void finish(std::unique_ptr<Request> request, Response response) {
+            --pending;
+            try {
+                request->done(std::move(response));
+            }
+            catch (...) {
+                // Callbacks own their error handling; the loop must keep serving other requests
+            }
+        }
+    };
+
+    HttpClient::Reactor::Reactor(std::size_t maxConcurrent) : state_(std::make_unique<State>()) {
+        if (maxConcurrent == 0) {
+            throw std::invalid_argument("Concurrency limit must be positive");
+        }
+        CurlShare::instance();
+        state_->maxConcurrent = maxConcurrent;
+        state_->multi = curl_multi_init();
+        if (!state_->multi) {
+            throw std::runtime_error("Failed to initialize CURL multi");
+        }
+        thread_ = std::thread([this] { run(); });
+    }
+
+    HttpClient::Reactor::~Reactor() {
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            state_->stopping = true;
+        }
+        curl_multi_wakeup(state_->multi);
+        thread_.join();
+        curl_multi_cleanup(state_->multi);
+    }
+
+    void HttpClient::Reactor::submit(std::string url, Callback done, Clock::time_point notBefore) {
+        auto request = std::make_unique<State::Request>();
+        request->url = std::move(url);
+        request->done = std::move(done);
+        request->notBefore = notBefore;
+
+        // Transport mode is fixed per request when it is submitted
+        const auto mode = HttpTransport::mode();
+        if (mode == HttpTransport::Mode::Replay) {
+            request->replay = true;
+            request->notBefore = std::max(notBefore, Clock::now()) + HttpTransport::nextLatency();
+        }
+        request->record = mode == HttpTransport::Mode::Record;
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (state_->stopping) {
+                throw std::runtime_error("HTTP reactor is stopping");
+            }
+            state_->submitted.push_back(std::move(request));
+            ++state_->pending;
+        }
+        // Interrupt the loop's poll so it picks the request up
+        curl_multi_wakeup(state_->multi);
+    }
+
+    std::future<HttpClient::Response> HttpClient::Reactor::get(std::string url, Clock::time_point notBefore) {
+        auto promise = std::make_shared<std::promise<Response>>();
+        auto future = promise->get_future();
+        submit(std::move(url), [promise](Response response) { promise->set_value(std::move(response)); }, notBefore);
+        return future;
+    }
+
+    std::size_t HttpClient::Reactor::pending() const {
+        return state_->pending.load();
+    }
+
+    void HttpClient::Reactor::run() {
+        State& state = *state_;
+        using Request = State::Request;
+
+        // Slot = index of a pooled easy handle; active[slot] is the request it is running
+        std::vector<std::unique_ptr<EasyHandle>> pool;
+        std::vector<std::unique_ptr<Request>> active;
+        std::vector<std::size_t> idle;
+        std::deque<std::unique_ptr<Request>> queue;
+        std::size_t running = 0;
+
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (state.stopping) {
+                    break;
+                }
+                while (!state.submitted.empty()) {
+                    queue.push_back(std::move(state.submitted.front()));
+                    state.submitted.pop_front();
+                }
+            }
+
+            // Start every due request while slots remain; remember when the next held one is due
+            const auto now = Clock::now();
+            std::optional<Clock::time_point> nextDue;
+            for (auto it = queue.begin(); it != queue.end();) {
+                if ((*it)->notBefore > now) {
+                    nextDue = nextDue ? std::min(*nextDue, (*it)->notBefore) : (*it)->notBefore;
+                    ++it;
+                    continue;
+                }
+                if ((*it)->replay) {
+                    const std::string url = (*it)->url;
+                    state.finish(std::move(*it), replayed(url));
+                    it = queue.erase(it);
+                    continue;
+                }
+                if (running == state.maxConcurrent) {
+                    break;
+                }
+                if (idle.empty()) {
+                    pool.push_back(std::make_unique<EasyHandle>());
+                    active.emplace_back();
+                    idle.push_back(pool.size() - 1);
+                }
+                const std::size_t slot = idle.back();
+                CURL* curl = pool[slot]->get();
+                curl_easy_setopt(curl, CURLOPT_URL, (*it)->url.c_str());
+                curl_easy_setopt(curl, CURLOPT_WRITEDATA, &(*it)->body);
+                curl_easy_setopt(curl, CURLOPT_PRIVATE, reinterpret_cast<void*>(static_cast<std::uintptr_t>(slot)));
+                if (curl_multi_add_handle(state.multi, curl) != CURLM_OK) {
+                    state.finish(std::move(*it), { {}, "Failed to queue CURL transfer" });
+                }
+                else {
+                    idle.pop_back();
+                    active[slot] = std::move(*it);
+                    ++running;
+                }
+                it = queue.erase(it);
+            }
+
+            int stillRunning = 0;
+            curl_multi_perform(state.multi, &stillRunning);
+
+            // Complete finished transfers
+            bool finished = false;
+            int queued = 0;
+            while (CURLMsg* message = curl_multi_info_read(state.multi, &queued)) {
+                if (message->msg != CURLMSG_DONE) {
+                    continue;
+                }
+                void* privateData = nullptr;
+                curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &privateData);
+                const auto slot = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(privateData));
+                const CURLcode result = message->data.result;
+                curl_multi_remove_handle(state.multi, message->easy_handle);
+                curl_easy_setopt(message->easy_handle, CURLOPT_WRITEDATA, nullptr);
+
+                std::unique_ptr<Request> request = std::move(active[slot]);
+                Response response;
+                if (result == CURLE_OK) {
+                    response.body = std::move(request->body);
+                    if (request->record) {
+                        recordQuietly(request->url, response.body);
+                    }
+                }
+                else {
+                    response.error = curl_easy_strerror(result);
+                }
+                idle.push_back(slot);
+                --running;
+                finished = true;
+                state.finish(std::move(request), std::move(response));
+            }
+
+            // Go straight round if freed slots can start queued work; otherwise wait for sockets,
+            // a submit/stop wakeup, or the next held request
+            const auto due = [](const std::unique_ptr<Request>& request) { return request->notBefore <= Clock::now(); };
+            if (finished && std::any_of(queue.begin(), queue.end(), due)) {
+                continue;
+            }
+            int timeoutMs = 1000;
+            if (nextDue && running < state.maxConcurrent) {
+                const auto wait = std::chrono::ceil<std::chrono::milliseconds>(*nextDue - Clock::now()).count();
+                timeoutMs = static_cast<int>(std::clamp<long long>(wait, 0, 1000));
+            }
+            curl_multi_poll(state.multi, nullptr, 0, timeoutMs, nullptr);
+        }
+
+        // Shutting down: everything still outstanding fails
+        for (std::size_t slot = 0; slot < active.size(); ++slot) {
+            if (active[slot]) {
+                curl_multi_remove_handle(state.multi, pool[slot]->get());
+                state.finish(std::move(active[slot]), { {}, "HTTP reactor stopped" });
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            while (!state.submitted.empty()) {
+                queue.push_back(std::move(state.submitted.front()));
+                state.submitted.pop_front();
+            }
+        }
+        for (auto& request : queue) {
+            state.finish(std::move(request), { {}, "HTTP reactor stopped" });
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+// Same project headers.
+#include "Core/HttpTransport.h"
+#include "Core/ResponseCache.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace QuantEngine {
+    namespace {
+        std::mutex transportMutex;
+        HttpTransport::Settings current;
+        std::mt19937_64 jitterSource(1);
+
+        // Longest readable fixture name before it is shortened with a hash
+        constexpr std::size_t MaxFixtureName = 180;
+    }
+
+    void HttpTransport::configure(const Settings& settings) {
+        if (settings.mode != Mode::Live && settings.fixtures.empty()) {
+            throw std::invalid_argument("Record and replay modes need a fixture directory");
+        }
+        if (settings.latency.count() < 0 || settings.jitter.count() < 0) {
+            throw std::invalid_argument("Replay latency and jitter must not be negative");
+        }
+        std::lock_guard<std::mutex> lock(transportMutex);
+        current = settings;
+        jitterSource.seed(settings.seed);
+    }
+
+    HttpTransport::Settings HttpTransport::settings() {
+        std::lock_guard<std::mutex> lock(transportMutex);
+        return current;
+    }
+
+    HttpTransport::Mode HttpTransport::mode() {
+        std::lock_guard<std::mutex> lock(transportMutex);
+        return current.mode;
+    }
+
+    std::filesystem::path HttpTransport::fixturePath(const std::filesystem::path& directory, const std::string& url) {
+        // Readable name from the credential-free key: host, path and sorted query
+        std::string key = ResponseCache::normalize(url);
+        const auto scheme = key.find("://");
+        if (scheme != std::string::npos) {
+            key.erase(0, scheme + 3);
+        }
+        std::string name;
+        name.reserve(key.size());
+        for (char c : key) {
+            const bool plain = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                c == '.' || c == '-' || c == '=';
+            name += plain ? c : '_';
+        }
+
+        // Very long keys keep a readable prefix plus a portable hash of the whole key
+        if (name.size() > MaxFixtureName) {
+            std::ostringstream hashed;
+            hashed << name.substr(0, MaxFixtureName) << '_' << std::hex << std::setw(16) << std::setfill('0')
+                << ResponseCache::keyHash(key);
+            name = hashed.str();
+        }
+        return directory / (name + ".body");
+    }
+
+    std::optional<std::string> HttpTransport::replay(const std::string& url) {
+        std::ifstream in(fixturePath(settings().fixtures, url), std::ios::binary);
+        if (!in) {
+            return std::nullopt;
+        }
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void HttpTransport::record(const std::string& url, std::string_view body) {
+        static std::atomic<std::uint64_t> writeCounter{ 0 };
+        const auto directory = settings().fixtures;
+        if (directory.empty()) {
+            throw std::logic_error("No HTTP fixture directory configured");
+        }
+        std::filesystem::create_directories(directory);
+
+        const auto path = fixturePath(directory, url);
+        const auto tmpPath = path.string() + ".tmp" + std::to_string(writeCounter++);
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            out.write(body.data(), static_cast<std::streamsize>(body.size()));
+            if (!out) {
+                throw std::runtime_error("Failed writing HTTP fixture: " + tmpPath);
+            }
+        }
+        std::filesystem::rename(tmpPath, path);
+    }
+
+    std::chrono::milliseconds HttpTransport::nextLatency() {
+        std::lock_guard<std::mutex> lock(transportMutex);
+        if (current.jitter.count() == 0) {
+            return current.latency;
+        }
+        std::uniform_int_distribution<long long> spread(-current.jitter.count(), current.jitter.count());
+        return std::chrono::milliseconds(std::max<long long>(0, current.latency.count() + spread(jitterSource)));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+// Same project headers.
+#include "Core/InstrumentArena.h"
+// 3rd party headers.
+// ....
+// std headers.
+
+namespace QuantEngine {
+    InstrumentArena::InstrumentArena(std::size_t initialBytes, std::pmr::memory_resource* upstream)
+        : buffer_(initialBytes, upstream) {
+    }
+
+    InstrumentArena::~InstrumentArena() {
+        reset();
+    }
+
+    template<typename T>
+    EuropeanStockOption<T>& InstrumentArena::createEuropeanOption(const typename Instrument<T>::Parameters& params,
+        std::shared_ptr<PricingEngine<T>> engine, const MarketData<T>& market, bool observeEngine) {
+        auto& option = create<EuropeanStockOption<T>>(params, resource());
+        option.setPricingEngine(std::move(engine), observeEngine);
+        option.updateMarketData(market);  // Copies into arena-backed containers
+        return option;
+    }
+
+    void InstrumentArena::reset() {
+        // Newest first, mirroring stack unwinding
+        for (auto it = cleanups_.rbegin(); it != cleanups_.rend(); ++it) {
+            it->destroy(it->object);
+        }
+        cleanups_.clear();
+        objects_ = 0;
+        buffer_.release();
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template EuropeanStockOption<double>& InstrumentArena::createEuropeanOption<double>(
+        const Instrument<double>::Parameters&, std::shared_ptr<PricingEngine<double>>, const MarketData<double>&, bool);
+    template EuropeanStockOption<float>& InstrumentArena::createEuropeanOption<float>(
+        const Instrument<float>::Parameters&, std::shared_ptr<PricingEngine<float>>, const MarketData<float>&, bool);
+}
\ No newline at end of file
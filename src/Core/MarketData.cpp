@@ -4,11 +4,57 @@
 // ....
 // std headers.
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 
 namespace QuantEngine {
+    namespace {
+        // Shared by every MarketData type so versions never repeat within a process
+        std::atomic<std::uint64_t> versionCounter{ 0 };
+
+        // Lowest volatility a shock can produce
+        template<typename T>
+        constexpr T MinShockedVolatility = T(1e-4);
+
+        // Parallel shift of another surface's volatilities
+        template<typename T>
+        class ShiftedVolSurface : public VolatilitySurface<T> {
+        public:
+            ShiftedVolSurface(std::shared_ptr<const VolatilitySurface<T>> base, T shift)
+                : base_(std::move(base)), shift_(shift) {}
+
+            T volatility(T strike, T maturity) const override {
+                return std::max(base_->volatility(strike, maturity) + shift_, MinShockedVolatility<T>);
+            }
+
+        private:
+            std::shared_ptr<const VolatilitySurface<T>> base_;
+            T shift_;
+        };
+    }
+
+    template<typename T>
+    std::uint64_t MarketData<T>::nextVersion() {
+        return ++versionCounter;
+    }
+
+    template<typename T>
+    MarketData<T>::MarketData(std::pmr::memory_resource* resource)
+        : yield_curve_(resource), vol_surface_(resource), strikes_(resource), maturities_(resource) {
+    }
+
+    template<typename T>
+    MarketData<T>::MarketData(const MarketData& other, std::pmr::memory_resource* resource)
+        : yield_curve_(other.yield_curve_, resource), curve_(other.curve_),
+        vol_surface_(other.vol_surface_, resource), surface_(other.surface_),
+        strikes_(other.strikes_, resource), maturities_(other.maturities_, resource),
+        version_(other.version_) {
+    }
+
     template<typename T>
     void MarketData<T>::addRiskFreeRate(T time, T rate) {
         // Validate input parameters before storage
@@ -17,6 +63,9 @@ namespace QuantEngine {
         }
         // Store time-to-rate mapping for yield curve
         yield_curve_[time] = rate;
+        // A curve built from the old points no longer matches them
+        curve_.reset();
+        version_ = nextVersion();
     }
 
     template<typename T>
@@ -25,6 +74,10 @@ namespace QuantEngine {
         if (strike <= 0 || maturity < 0 || volatility < 0) {
             throw std::invalid_argument("Invalid strike/maturity/volatility");
         }
+        // Lookups answer from an attached or compressed surface, which would silently ignore the new point
+        if (surface_) {
+            throw std::logic_error("Cannot add volatility points while a volatility surface is attached");
+        }
 
         // Store volatility point in surface map
         vol_surface_[{strike, maturity}] = volatility;
@@ -40,10 +93,16 @@ namespace QuantEngine {
         if (mt_it == maturities_.end() || *mt_it != maturity) {
             maturities_.insert(mt_it, maturity);
         }
+        version_ = nextVersion();
     }
 
     template<typename T>
     T MarketData<T>::getRiskFreeRate(T time) const {
+        // Precomputed curve takes precedence over raw points
+        if (curve_) {
+            return curve_->zeroRate(time);
+        }
+
         // Check for initialized yield curve data
         if (yield_curve_.empty()) {
             throw std::runtime_error("Yield curve is empty");
@@ -81,6 +140,11 @@ namespace QuantEngine {
 
     template<typename T>
     T MarketData<T>::getVolatility(T strike, T maturity) const {
+        // Attached surface takes precedence over raw points
+        if (surface_) {
+            return surface_->volatility(strike, maturity);
+        }
+
         // First check for exact match in volatility surface
         auto exact_it{ vol_surface_.find({ strike, maturity }) };
         if (exact_it != vol_surface_.end()) {
@@ -176,6 +240,101 @@ namespace QuantEngine {
             x_ratio * y_ratio * v11;
     }
 
+    template<typename T>
+    T MarketData<T>::getDiscountFactor(T time) const {
+        // Shared per-maturity cache avoids re-evaluating exp for every instrument
+        if (curve_) {
+            return curve_->cachedDiscountFactor(time);
+        }
+        return std::exp(-getRiskFreeRate(time) * time);
+    }
+
+    template<typename T>
+    void MarketData<T>::setYieldCurve(std::shared_ptr<const YieldCurve<T>> curve) {
+        curve_ = std::move(curve);
+        version_ = nextVersion();
+    }
+
+    template<typename T>
+    void MarketData<T>::buildYieldCurve(typename YieldCurve<T>::Interpolation method) {
+        if (yield_curve_.empty()) {
+            throw std::runtime_error("Yield curve is empty");
+        }
+
+        // Flatten the map into the curve's node arrays
+        std::vector<T> times, rates;
+        times.reserve(yield_curve_.size());
+        rates.reserve(yield_curve_.size());
+        for (const auto& [time, rate] : yield_curve_) {
+            times.push_back(time);
+            rates.push_back(rate);
+        }
+        curve_ = std::make_shared<const YieldCurve<T>>(std::move(times), std::move(rates), method);
+        version_ = nextVersion();
+    }
+
+    template<typename T>
+    void MarketData<T>::setVolatilitySurface(std::shared_ptr<const VolatilitySurface<T>> surface) {
+        surface_ = std::move(surface);
+        version_ = nextVersion();
+    }
+
+    template<typename T>
+    void MarketData<T>::compressVolatilities(VolatilityStorage storage) {
+        if (vol_surface_.empty()) {
+            throw std::runtime_error("Volatility surface not initialized");
+        }
+
+        // Densify the points onto the strike x maturity axes (NaN marks missing nodes)
+        std::vector<T> grid(strikes_.size() * maturities_.size(), std::numeric_limits<T>::quiet_NaN());
+        for (const auto& [key, vol] : vol_surface_) {
+            const auto i = std::lower_bound(strikes_.begin(), strikes_.end(), key.first) - strikes_.begin();
+            const auto j = std::lower_bound(maturities_.begin(), maturities_.end(), key.second) - maturities_.begin();
+            grid[static_cast<std::size_t>(i) * maturities_.size() + static_cast<std::size_t>(j)] = vol;
+        }
+
+        // Encode, attach, and release the map nodes
+        if (storage == VolatilityStorage::Int16) {
+            surface_ = GridVolSurface<T, std::int16_t>::compress(strikes_, maturities_, grid);
+        }
+        else {
+            surface_ = GridVolSurface<T, float>::compress(strikes_, maturities_, grid);
+        }
+        vol_surface_.clear();
+        std::pmr::vector<T>(strikes_.get_allocator()).swap(strikes_);
+        std::pmr::vector<T>(maturities_.get_allocator()).swap(maturities_);
+        version_ = nextVersion();
+    }
+
+    template<typename T>
+    MarketData<T> MarketData<T>::shocked(T rateShift, T volShift) const {
+        MarketData<T> result(*this);
+
+        // Rate points and any curve built on them
+        for (auto& [time, rate] : result.yield_curve_) {
+            rate = std::max(rate + rateShift, T(0));
+        }
+        if (curve_) {
+            std::vector<T> rates(curve_->rates().begin(), curve_->rates().end());
+            for (T& rate : rates) {
+                rate = std::max(rate + rateShift, T(0));
+            }
+            result.curve_ = std::make_shared<const YieldCurve<T>>(
+                std::vector<T>(curve_->times().begin(), curve_->times().end()), std::move(rates), curve_->interpolation());
+        }
+
+        // Volatility points, or a wrapper over the attached surface
+        for (auto& [key, vol] : result.vol_surface_) {
+            vol = std::max(vol + volShift, MinShockedVolatility<T>);
+        }
+        if (surface_) {
+            result.surface_ = std::make_shared<const ShiftedVolSurface<T>>(surface_, volShift);
+        }
+
+        result.version_ = nextVersion();
+        return result;
+    }
+
     // Explicit template instantiation prevents linker errors
     // Generates concrete implementations for these types
     template class MarketData<double>;
@@ -0,0 +1,131 @@
+// Same project headers.
+#include "Core/MarketDataBuilder.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <stdexcept>
+
+namespace QuantEngine {
+    template<typename T>
+    MarketDataBuilder<T>& MarketDataBuilder<T>::reserve(std::size_t rateCount, std::size_t volCount) {
+        rates_.reserve(rateCount);
+        vols_.reserve(volCount);
+        return *this;
+    }
+
+    template<typename T>
+    MarketDataBuilder<T>& MarketDataBuilder<T>::addRiskFreeRate(T time, T rate) {
+        // Validate input parameters before staging
+        if (time < 0 || rate < 0) {
+            throw std::invalid_argument("Invalid time/rate");
+        }
+        rates_.emplace_back(time, rate);
+        return *this;
+    }
+
+    template<typename T>
+    MarketDataBuilder<T>& MarketDataBuilder<T>::addRiskFreeRates(std::span<const T> times,
+        std::span<const T> rates) {
+        if (times.size() != rates.size()) {
+            throw std::invalid_argument("Rate batch arrays differ in length");
+        }
+        rates_.reserve(rates_.size() + times.size());
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            addRiskFreeRate(times[i], rates[i]);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    MarketDataBuilder<T>& MarketDataBuilder<T>::addVolatility(T strike, T maturity, T volatility) {
+        // Verify valid financial parameters
+        if (strike <= 0 || maturity < 0 || volatility < 0) {
+            throw std::invalid_argument("Invalid strike/maturity/volatility");
+        }
+        vols_.push_back({ strike, maturity, volatility });
+        return *this;
+    }
+
+    template<typename T>
+    MarketDataBuilder<T>& MarketDataBuilder<T>::addVolatilities(std::span<const T> strikes,
+        std::span<const T> maturities, std::span<const T> volatilities) {
+        if (strikes.size() != maturities.size() || strikes.size() != volatilities.size()) {
+            throw std::invalid_argument("Volatility batch arrays differ in length");
+        }
+        vols_.reserve(vols_.size() + strikes.size());
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            addVolatility(strikes[i], maturities[i], volatilities[i]);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    MarketDataBuilder<T>& MarketDataBuilder<T>::addVolatilityGrid(std::span<const T> strikes,
+        std::span<const T> maturities, std::span<const T> volatilities) {
+        if (volatilities.size() != strikes.size() * maturities.size()) {
+            throw std::invalid_argument("Volatility grid size does not match its axes");
+        }
+        vols_.reserve(vols_.size() + volatilities.size());
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            for (std::size_t j = 0; j < maturities.size(); ++j) {
+                addVolatility(strikes[i], maturities[j], volatilities[i * maturities.size() + j]);
+            }
+        }
+        return *this;
+    }
+
+    template<typename T>
+    MarketData<T> MarketDataBuilder<T>::build() {
+        MarketData<T> market;
+
+        // Sort rates by time; stable so the last duplicate wins when collapsing
+        std::stable_sort(rates_.begin(), rates_.end(),
+            [](const auto& l, const auto& r) { return l.first < r.first; });
+        for (std::size_t i = 0; i < rates_.size(); ++i) {
+            if (i + 1 < rates_.size() && rates_[i + 1].first == rates_[i].first) {
+                continue;
+            }
+            // Sorted input makes every hinted insert amortised O(1)
+            market.yield_curve_.emplace_hint(market.yield_curve_.end(), rates_[i]);
+        }
+
+        // Sort vol points by (strike, maturity), same key order as the surface map
+        std::stable_sort(vols_.begin(), vols_.end(), [](const VolPoint& l, const VolPoint& r) {
+            return l.strike < r.strike || (l.strike == r.strike && l.maturity < r.maturity);
+            });
+
+        market.strikes_.reserve(vols_.size());
+        market.maturities_.reserve(vols_.size());
+        for (std::size_t i = 0; i < vols_.size(); ++i) {
+            const VolPoint& p = vols_[i];
+            if (i + 1 < vols_.size() && vols_[i + 1].strike == p.strike && vols_[i + 1].maturity == p.maturity) {
+                continue;
+            }
+            market.vol_surface_.emplace_hint(market.vol_surface_.end(),
+                std::pair<T, T>{ p.strike, p.maturity }, p.volatility);
+
+            // Strikes arrive sorted, so only adjacent duplicates need skipping
+            if (market.strikes_.empty() || market.strikes_.back() != p.strike) {
+                market.strikes_.push_back(p.strike);
+            }
+            market.maturities_.push_back(p.maturity);
+        }
+
+        // Maturities need one sort and unique pass of their own
+        std::sort(market.maturities_.begin(), market.maturities_.end());
+        market.maturities_.erase(std::unique(market.maturities_.begin(), market.maturities_.end()),
+            market.maturities_.end());
+        market.strikes_.shrink_to_fit();
+        market.maturities_.shrink_to_fit();
+
+        // Leave the builder ready for the next load
+        rates_.clear();
+        vols_.clear();
+        return market;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class MarketDataBuilder<double>;
+    template class MarketDataBuilder<float>;
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+// Same project headers.
+#include "Core/MarketDataSnapshot.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace QuantEngine {
+    namespace {
+        constexpr char SnapshotMagic[8] = { 'Q', 'E', 'M', 'D', 'S', 'N', 'A', 'P' };
+        constexpr std::uint32_t EndianTag = 0x01020304u;
+
+        // Rounds a byte offset up to the next multiple of alignment
+        std::uint64_t alignUp(std::uint64_t offset, std::uint64_t alignment) {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        // Decodes an attached grid surface of the given storage into full-precision arrays
+        template<typename T, typename Storage>
+        bool decodeGrid(const std::shared_ptr<const VolatilitySurface<T>>& surface,
+            std::vector<T>& strikes, std::vector<T>& maturities, std::vector<T>& vols) {
+            auto grid = std::dynamic_pointer_cast<const GridVolSurface<T, Storage>>(surface);
+            if (!grid) {
+                return false;
+            }
+            strikes.assign(grid->strikes().begin(), grid->strikes().end());
+            maturities.assign(grid->maturities().begin(), grid->maturities().end());
+            vols.resize(strikes.size() * maturities.size());
+            for (std::size_t i = 0; i < strikes.size(); ++i) {
+                for (std::size_t j = 0; j < maturities.size(); ++j) {
+                    vols[i * maturities.size() + j] = static_cast<T>(grid->nodeVolatility(i, j));
+                }
+            }
+            return true;
+        }
+    }
+
+    template<typename T>
+    void MarketDataSnapshot<T>::save(const MarketData<T>& market, const std::string& path) {
+        static_assert(sizeof(Header) <= HeaderSize, "Snapshot header outgrew its reserved space");
+
+        // Rate points: raw map first, otherwise the nodes of an attached curve
+        std::vector<T> rateTimes, rates;
+        if (!market.yield_curve_.empty()) {
+            for (const auto& [time, rate] : market.yield_curve_) {
+                rateTimes.push_back(time);
+                rates.push_back(rate);
+            }
+        }
+        else if (market.curve_) {
+            rateTimes.assign(market.curve_->times().begin(), market.curve_->times().end());
+            rates.assign(market.curve_->rates().begin(), market.curve_->rates().end());
+        }
+
+        // Vol grid: densify the sparse map, or decode a snapshot-backed or compressed grid surface
+        std::vector<T> strikes, maturities, vols;
+        if (!market.vol_surface_.empty()) {
+            strikes.assign(market.strikes_.begin(), market.strikes_.end());
+            maturities.assign(market.maturities_.begin(), market.maturities_.end());
+            vols.assign(strikes.size() * maturities.size(), std::numeric_limits<T>::quiet_NaN());
+            for (const auto& [key, vol] : market.vol_surface_) {
+                const auto i = std::lower_bound(strikes.begin(), strikes.end(), key.first) - strikes.begin();
+                const auto j = std::lower_bound(maturities.begin(), maturities.end(), key.second) - maturities.begin();
+                vols[static_cast<std::size_t>(i) * maturities.size() + static_cast<std::size_t>(j)] = vol;
+            }
+        }
+        else if (market.surface_) {
+            decodeGrid<T, T>(market.surface_, strikes, maturities, vols) ||
+                decodeGrid<T, float>(market.surface_, strikes, maturities, vols) ||
+                decodeGrid<T, std::int16_t>(market.surface_, strikes, maturities, vols);
+        }
+
+        // Build the header and lay out aligned sections
+        Header header{};
+        std::memcpy(header.magic, SnapshotMagic, sizeof(SnapshotMagic));
+        header.version = FormatVersion;
+        header.endianTag = EndianTag;
+        header.scalarSize = sizeof(T);
+        header.curveMethod = market.curve_ ? static_cast<std::uint32_t>(market.curve_->interpolation()) : NoCurve;
+        header.rateCount = rateTimes.size();
+        header.strikeCount = strikes.size();
+        header.maturityCount = maturities.size();
+
+        const std::vector<T>* sections[5] = { &rateTimes, &rates, &strikes, &maturities, &vols };
+        std::uint64_t position = HeaderSize;
+        for (int s = 0; s < 5; ++s) {
+            header.offsets[s] = position;
+            position = alignUp(position + sections[s]->size() * sizeof(T), Alignment);
+        }
+
+        // Side file unique to this writer, then swap it in
+        // The per-process token keeps threads in different processes apart too
+        static const std::uint64_t processToken = std::random_device{}();
+        static std::atomic<std::uint64_t> writeCounter{ 0 };
+        std::ostringstream suffix;
+        suffix << ".tmp" << std::hex << processToken << '_' << std::hash<std::thread::id>{}(std::this_thread::get_id())
+            << '_' << writeCounter++;
+        const std::string tmpPath = path + suffix.str();
+        try {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                throw std::runtime_error("Cannot write market data snapshot: " + tmpPath);
+            }
+
+            std::vector<char> padding(HeaderSize, 0);
+            std::memcpy(padding.data(), &header, sizeof(Header));
+            out.write(padding.data(), HeaderSize);
+
+            std::uint64_t written = HeaderSize;
+            for (int s = 0; s < 5; ++s) {
+                // Zero-fill up to the section's aligned start
+                const std::vector<char> gap(header.offsets[s] - written, 0);
+                out.write(gap.data(), static_cast<std::streamsize>(gap.size()));
+                out.write(reinterpret_cast<const char*>(sections[s]->data()),
+                    static_cast<std::streamsize>(sections[s]->size() * sizeof(T)));
+                written = header.offsets[s] + sections[s]->size() * sizeof(T);
+            }
+            if (!out) {
+                throw std::runtime_error("Failed writing market data snapshot: " + tmpPath);
+            }
+            out.close();
+            std::filesystem::rename(tmpPath, path);
+        }
+        catch (...) {
+            // Leave no partial side file behind
+            std::error_code ignored;
+            std::filesystem::remove(tmpPath, ignored);
+            throw;
+        }
+    }
+
+    template<typename T>
+    MarketDataSnapshot<T>::MarketDataSnapshot(const std::string& path)
+        : file_(std::make_shared<const MappedFile>(path)) {
+        if (file_->size() < HeaderSize) {
+            throw std::runtime_error("Market data snapshot too small: " + path);
+        }
+
+        // Validate the header before trusting any offset
+        Header header;
+        std::memcpy(&header, file_->data(), sizeof(Header));
+        if (std::memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0) {
+            throw std::runtime_error("Not a market data snapshot: " + path);
+        }
+        if (header.endianTag != EndianTag) {
+            throw std::runtime_error("Market data snapshot has foreign byte order: " + path);
+        }
+        if (header.version != FormatVersion) {
+            throw std::runtime_error("Unsupported market data snapshot version: " + std::to_string(header.version));
+        }
+        if (header.scalarSize != sizeof(T)) {
+            throw std::runtime_error("Market data snapshot precision does not match MarketData type");
+        }
+        if (header.curveMethod != NoCurve &&
+            header.curveMethod > static_cast<std::uint32_t>(YieldCurve<T>::Interpolation::MonotoneConvex)) {
+            throw std::runtime_error("Unknown yield curve interpolation in market data snapshot: " + path);
+        }
+        curveMethod_ = header.curveMethod;
+
+        // A grid too large to fit the file is corrupt (and must not wrap the vol count)
+        const std::uint64_t maxValues = file_->size() / sizeof(T);
+        if (header.maturityCount != 0 && header.strikeCount > maxValues / header.maturityCount) {
+            throw std::runtime_error("Corrupt market data snapshot section: " + path);
+        }
+
+        // Every section must be aligned and lie inside the file
+        const std::uint64_t counts[5] = { header.rateCount, header.rateCount, header.strikeCount,
+            header.maturityCount, header.strikeCount * header.maturityCount };
+        std::span<const T>* views[5] = { &rateTimes_, &rates_, &strikes_, &maturities_, &vols_ };
+        for (int s = 0; s < 5; ++s) {
+            const std::uint64_t offset = header.offsets[s];
+            if (offset % Alignment != 0 || offset > file_->size() ||
+                counts[s] > (file_->size() - offset) / sizeof(T)) {
+                throw std::runtime_error("Corrupt market data snapshot section: " + path);
+            }
+            *views[s] = std::span<const T>(reinterpret_cast<const T*>(file_->data() + offset),
+                static_cast<std::size_t>(counts[s]));
+        }
+
+        // Surface views the mapping and shares ownership of it
+        surface_ = std::make_shared<const GridVolSurface<T>>(strikes_, maturities_, vols_, file_);
+    }
+
+    template<typename T>
+    T MarketDataSnapshot<T>::getRiskFreeRate(T time) const {
+        if (rateTimes_.empty()) {
+            throw std::runtime_error("Yield curve is empty");
+        }
+
+        // Flat before the first and after the last point
+        const auto upper = std::upper_bound(rateTimes_.begin(), rateTimes_.end(), time);
+        if (upper == rateTimes_.begin()) {
+            return rates_.front();
+        }
+        if (upper == rateTimes_.end()) {
+            return rates_.back();
+        }
+
+        // Linear interpolation between neighbouring points
+        const std::size_t hi = static_cast<std::size_t>(upper - rateTimes_.begin());
+        const T t0 = rateTimes_[hi - 1], t1 = rateTimes_[hi];
+        const T alpha = (time - t0) / (t1 - t0);
+        return rates_[hi - 1] + alpha * (rates_[hi] - rates_[hi - 1]);
+    }
+
+    template<typename T>
+    T MarketDataSnapshot<T>::getVolatility(T strike, T maturity) const {
+        return surface_->volatility(strike, maturity);
+    }
+
+    template<typename T>
+    MarketData<T> MarketDataSnapshot<T>::toMarketData() const {
+        MarketData<T> market;
+
+        // Rate points are few; rebuild the curve the writer had attached
+        for (std::size_t i = 0; i < rateTimes_.size(); ++i) {
+            market.addRiskFreeRate(rateTimes_[i], rates_[i]);
+        }
+        if (curveMethod_ != NoCurve && !rateTimes_.empty()) {
+            market.buildYieldCurve(static_cast<typename YieldCurve<T>::Interpolation>(curveMethod_));
+        }
+
+        // Vol lookups read straight from the mapping
+        if (!strikes_.empty()) {
+            market.setVolatilitySurface(surface_);
+        }
+        return market;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class MarketDataSnapshot<double>;
+    template class MarketDataSnapshot<float>;
+}
\ No newline at end of file
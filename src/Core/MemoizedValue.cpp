@@ -0,0 +1,140 @@
+// Same project headers.
+#include "Core/MemoizedValue.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <exception>
+#include <utility>
+
+namespace QuantEngine {
+    template<typename T>
+    std::shared_future<T> MemoizedValue<T>::join(Callback callback, bool& leader, std::optional<T>& fresh) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        leader = false;
+        if (value_ && Clock::now() - loadedAt_ < maxAge_) {
+            fresh = value_;
+            return {};
+        }
+        // First caller in becomes the loader; the rest share its future
+        if (!inFlight_.valid()) {
+            promise_ = std::make_shared<std::promise<T>>();
+            inFlight_ = promise_->get_future().share();
+            ++loads_;
+            leader = true;
+        }
+        if (callback) {
+            waiters_.push_back(std::move(callback));
+        }
+        return inFlight_;
+    }
+
+    template<typename T>
+    void MemoizedValue<T>::settle(const std::function<void(std::promise<T>&)>& resolve, const std::optional<T>& value) {
+        std::shared_ptr<std::promise<T>> promise;
+        std::shared_future<T> result;
+        std::vector<Callback> waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!promise_) {
+                return;     // No load running
+            }
+            if (value) {
+                value_ = value;
+                loadedAt_ = Clock::now();
+            }
+            promise = std::move(promise_);
+            result = std::move(inFlight_);
+            waiters = std::move(waiters_);
+            promise_.reset();
+            inFlight_ = {};
+            waiters_.clear();
+        }
+
+        // Outside the lock, so waiters may immediately ask again
+        resolve(*promise);
+        for (auto& waiter : waiters) {
+            waiter(result);
+        }
+    }
+
+    template<typename T>
+    T MemoizedValue<T>::get(const std::function<T()>& load) {
+        bool leader = false;
+        std::optional<T> fresh;
+        const std::shared_future<T> flight = join({}, leader, fresh);
+        if (fresh) {
+            return *fresh;
+        }
+
+        if (leader) {
+            try {
+                complete(load());
+            }
+            catch (...) {
+                fail(std::current_exception());
+            }
+        }
+        return flight.get();
+    }
+
+    template<typename T>
+    void MemoizedValue<T>::getAsync(Callback callback, const std::function<void()>& start) {
+        bool leader = false;
+        std::optional<T> fresh;
+        join(callback, leader, fresh);
+        if (fresh) {
+            // Fresh value: answer at once with a ready future
+            std::promise<T> ready;
+            ready.set_value(*fresh);
+            callback(ready.get_future().share());
+            return;
+        }
+
+        if (leader) {
+            try {
+                start();
+            }
+            catch (...) {
+                fail(std::current_exception());
+            }
+        }
+    }
+
+    template<typename T>
+    void MemoizedValue<T>::complete(T value) {
+        settle([&value](std::promise<T>& promise) { promise.set_value(value); }, value);
+    }
+
+    template<typename T>
+    void MemoizedValue<T>::fail(std::exception_ptr error) {
+        settle([&error](std::promise<T>& promise) { promise.set_exception(error); }, std::nullopt);
+    }
+
+    template<typename T>
+    void MemoizedValue<T>::setMaxAge(Clock::duration maxAge) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        maxAge_ = maxAge;
+    }
+
+    template<typename T>
+    typename MemoizedValue<T>::Clock::duration MemoizedValue<T>::maxAge() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return maxAge_;
+    }
+
+    template<typename T>
+    void MemoizedValue<T>::invalidate() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        value_.reset();
+    }
+
+    template<typename T>
+    std::uint64_t MemoizedValue<T>::loads() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return loads_;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class MemoizedValue<double>;
+    template class MemoizedValue<float>;
+}
\ No newline at end of file
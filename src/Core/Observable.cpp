@@ -0,0 +1,35 @@
+// Same project headers.
+#include "Core/Observable.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <vector>
+
+namespace QuantEngine {
+    void Observable::registerObserver(Observer* observer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        observers_.insert(observer);
+    }
+
+    void Observable::unregisterObserver(Observer* observer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        observers_.erase(observer);
+    }
+
+    std::size_t Observable::observerCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return observers_.size();
+    }
+
+    void Observable::notifyObservers() const {
+        // Snapshot first so observers may (un)register from update() without deadlocking
+        std::vector<Observer*> targets;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            targets.assign(observers_.begin(), observers_.end());
+        }
+        for (Observer* observer : targets) {
+            observer->update();
+        }
+    }
+}
\ No newline at end of file
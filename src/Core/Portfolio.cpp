@@ -0,0 +1,133 @@
+// Same project headers.
+#include "Core/Portfolio.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <stdexcept>
+
+namespace QuantEngine {
+    template<typename T>
+    void Portfolio<T>::reserve(std::size_t n) {
+        notionals_.reserve(n);
+        strikes_.reserve(n);
+        maturities_.reserve(n);
+        spots_.reserve(n);
+        isCall_.reserve(n);
+        tradeIds_.reserve(n);
+        underlyings_.reserve(n);
+    }
+
+    template<typename T>
+    typename Portfolio<T>::UnderlyingId Portfolio<T>::addUnderlying(const std::string& name,
+        std::shared_ptr<const MarketData<T>> market) {
+        if (!market) {
+            throw std::invalid_argument("Underlying needs market data: " + name);
+        }
+
+        // Known names keep their id so existing trades stay attached
+        auto it = ids_.find(name);
+        if (it != ids_.end()) {
+            markets_[it->second] = std::move(market);
+            return it->second;
+        }
+
+        const UnderlyingId id = static_cast<UnderlyingId>(names_.size());
+        names_.push_back(name);
+        markets_.push_back(std::move(market));
+        ids_.emplace(name, id);
+        return id;
+    }
+
+    template<typename T>
+    void Portfolio<T>::setMarket(UnderlyingId underlying, std::shared_ptr<const MarketData<T>> market) {
+        if (underlying >= markets_.size()) {
+            throw std::out_of_range("Unknown underlying id");
+        }
+        if (!market) {
+            throw std::invalid_argument("Underlying needs market data: " + names_[underlying]);
+        }
+        markets_[underlying] = std::move(market);
+    }
+
+    template<typename T>
+    typename Portfolio<T>::UnderlyingId Portfolio<T>::underlyingId(const std::string& name) const {
+        auto it = ids_.find(name);
+        if (it == ids_.end()) {
+            throw std::out_of_range("Unknown underlying: " + name);
+        }
+        return it->second;
+    }
+
+    template<typename T>
+    const std::string& Portfolio<T>::underlyingName(UnderlyingId underlying) const {
+        return names_.at(underlying);
+    }
+
+    template<typename T>
+    const MarketData<T>& Portfolio<T>::market(UnderlyingId underlying) const {
+        return *markets_.at(underlying);
+    }
+
+    template<typename T>
+    std::size_t Portfolio<T>::addTrade(TradeId id, UnderlyingId underlying,
+        const typename Instrument<T>::Parameters& params) {
+        // Same contract checks as a standalone option
+        if (params.strike_ <= 0) throw std::invalid_argument("Strike price must be positive");
+        if (params.maturity_ <= 0) throw std::invalid_argument("Time to maturity must be positive");
+        if (params.spotPrice_ <= 0) throw std::invalid_argument("Stock spot price must be positive");
+        if (params.notional_ <= 0) throw std::invalid_argument("Contract notional must be positive");
+        if (underlying >= markets_.size()) {
+            throw std::out_of_range("Unknown underlying id");
+        }
+
+        // Scatter the fields into their columns
+        notionals_.push_back(params.notional_);
+        strikes_.push_back(params.strike_);
+        maturities_.push_back(params.maturity_);
+        spots_.push_back(params.spotPrice_);
+        isCall_.push_back(params.isCall_ ? 1 : 0);
+        tradeIds_.push_back(id);
+        underlyings_.push_back(underlying);
+        return tradeIds_.size() - 1;
+    }
+
+    template<typename T>
+    typename Instrument<T>::Parameters Portfolio<T>::parameters(std::size_t row) const {
+        if (row >= size()) {
+            throw std::out_of_range("Trade row out of range");
+        }
+        return { notionals_[row], strikes_[row], maturities_[row], spots_[row], isCall_[row] != 0 };
+    }
+
+    template<typename T>
+    void Portfolio<T>::clear() {
+        notionals_.clear();
+        strikes_.clear();
+        maturities_.clear();
+        spots_.clear();
+        isCall_.clear();
+        tradeIds_.clear();
+        underlyings_.clear();
+    }
+
+    template<typename T>
+    std::size_t Portfolio<T>::footprint() const {
+        return size() * (4 * sizeof(T) + sizeof(std::uint8_t) + sizeof(TradeId) + sizeof(UnderlyingId));
+    }
+
+    template<typename T>
+    T PortfolioRow<T>::price() const {
+        throw std::logic_error("Portfolio row cannot price itself; pass it to an engine");
+    }
+
+    template<typename T>
+    Greeks<T> PortfolioRow<T>::greeks() const {
+        throw std::logic_error("Portfolio row cannot compute its own Greeks; pass it to an engine");
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class Portfolio<double>;
+    template class Portfolio<float>;
+    template class PortfolioRow<double>;
+    template class PortfolioRow<float>;
+}
\ No newline at end of file
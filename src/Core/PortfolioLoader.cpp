@@ -0,0 +1,387 @@
+// Same project headers.
+#include "Core/PortfolioLoader.h"
+#include "Core/MappedFile.h"
+#include "Core/ParallelFor.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace QuantEngine {
+    namespace {
+        constexpr char BinaryMagic[8] = { 'Q', 'E', 'P', 'O', 'R', 'T', 'F', 'O' };
+        constexpr std::uint32_t BinaryVersion = 1;
+        constexpr std::uint32_t EndianTag = 0x01020304u;
+        constexpr std::size_t HeaderSize = 128;
+        constexpr std::size_t Alignment = 64;
+        constexpr std::size_t ColumnCount = 8;
+
+        // Smallest CSV chunk worth a thread of its own
+        constexpr std::size_t MinChunkBytes = 1 << 16;
+
+        // On-disk header of the binary trade format
+        struct BinaryHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t endianTag;
+            std::uint32_t scalarSize;
+            std::uint32_t reserved;
+            std::uint64_t tradeCount;
+            std::uint64_t nameBytes;              // Newline-terminated underlying names
+            std::uint64_t offsets[ColumnCount];   // names, ids, underlyings, flags, notionals, strikes, maturities, spots
+        };
+
+        // Rounds a byte offset up to the next multiple of alignment
+        std::uint64_t alignUp(std::uint64_t offset, std::uint64_t alignment) {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        std::string_view trim(std::string_view s) {
+            while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+            while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+            return s;
+        }
+
+        template<typename V>
+        bool parseNumber(std::string_view field, V& value) {
+            field = trim(field);
+            const char* end = field.data() + field.size();
+            const auto result = std::from_chars(field.data(), end, value);
+            return result.ec == std::errc() && result.ptr == end;
+        }
+
+        bool parseType(std::string_view field, bool& isCall) {
+            field = trim(field);
+            auto equals = [field](std::string_view word) {
+                return field.size() == word.size() && std::equal(field.begin(), field.end(), word.begin(),
+                    [](char a, char b) { return (a | 0x20) == b; });
+            };
+            if (equals("call") || equals("c")) { isCall = true; return true; }
+            if (equals("put") || equals("p")) { isCall = false; return true; }
+            return false;
+        }
+
+        // Batch form of EuropeanStockOption::validate; returns null when the terms are valid
+        template<typename T>
+        const char* checkTerms(const typename Instrument<T>::Parameters& p) {
+            if (!(p.strike_ > 0) || !std::isfinite(p.strike_)) return "Strike price must be positive";
+            if (!(p.maturity_ > 0) || !std::isfinite(p.maturity_)) return "Time to maturity must be positive";
+            if (!(p.spotPrice_ > 0) || !std::isfinite(p.spotPrice_)) return "Stock spot price must be positive";
+            if (!(p.notional_ > 0) || !std::isfinite(p.notional_)) return "Contract notional must be positive";
+            return nullptr;
+        }
+
+        // Rows parsed from one newline-aligned slice of the CSV
+        template<typename T>
+        struct CsvChunk {
+            std::string_view text;
+            std::vector<std::string_view> names;
+            std::unordered_map<std::string_view, std::uint32_t> nameIndex;
+            std::vector<std::uint64_t> tradeIds;
+            std::vector<std::uint32_t> underlyingIndex;
+            std::vector<typename Instrument<T>::Parameters> parameters;
+            std::vector<LoadIssue> issues;   // Rows relative to the chunk start
+            std::size_t lines = 0;
+
+            void parse() {
+                std::size_t position = 0;
+                while (position < text.size()) {
+                    const std::size_t eol = std::min(text.find('\n', position), text.size());
+                    parseLine(text.substr(position, eol - position), ++lines);
+                    position = eol + 1;
+                }
+            }
+
+            void parseLine(std::string_view line, std::size_t row) {
+                if (trim(line).empty()) {
+                    return;
+                }
+
+                // Split the fields; exactly seven are expected
+                std::string_view fields[7];
+                std::size_t count = 0;
+                for (std::size_t position = 0;;) {
+                    const std::size_t comma = line.find(',', position);
+                    if (count < 7) {
+                        fields[count] = line.substr(position, comma == std::string_view::npos ? comma : comma - position);
+                    }
+                    ++count;
+                    if (comma == std::string_view::npos) break;
+                    position = comma + 1;
+                }
+                if (count != 7) {
+                    issues.push_back({ row, "Expected 7 fields" });
+                    return;
+                }
+
+                std::uint64_t id = 0;
+                typename Instrument<T>::Parameters p{};
+                const std::string_view name = trim(fields[1]);
+                if (!parseNumber(fields[0], id)) { issues.push_back({ row, "Invalid trade id" }); return; }
+                if (name.empty()) { issues.push_back({ row, "Missing underlying" }); return; }
+                if (!parseNumber(fields[2], p.notional_) || !parseNumber(fields[3], p.strike_) ||
+                    !parseNumber(fields[4], p.maturity_) || !parseNumber(fields[5], p.spotPrice_)) {
+                    issues.push_back({ row, "Invalid number" });
+                    return;
+                }
+                if (!parseType(fields[6], p.isCall_)) { issues.push_back({ row, "Option type must be call or put" }); return; }
+                if (const char* error = checkTerms<T>(p)) { issues.push_back({ row, error }); return; }
+
+                auto [it, inserted] = nameIndex.try_emplace(name, static_cast<std::uint32_t>(names.size()));
+                if (inserted) names.push_back(name);
+                tradeIds.push_back(id);
+                underlyingIndex.push_back(it->second);
+                parameters.push_back(p);
+            }
+        };
+    }
+
+    template<typename T>
+    TradeFile<T> PortfolioLoader<T>::parseCsv(std::string_view text, unsigned threads) {
+        // A first line that does not start with a digit is a header
+        std::size_t lineBase = 0;
+        const std::string_view first = trim(text.substr(0, text.find('\n')));
+        if (!first.empty() && !(first.front() >= '0' && first.front() <= '9')) {
+            const std::size_t eol = text.find('\n');
+            text = eol == std::string_view::npos ? std::string_view() : text.substr(eol + 1);
+            lineBase = 1;
+        }
+
+        // Cut into newline-aligned chunks, a few per worker for balance
+        unsigned workers = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t target = std::clamp<std::size_t>(text.size() / MinChunkBytes, 1, std::size_t{ workers } * 4);
+        std::vector<CsvChunk<T>> chunks;
+        chunks.reserve(target);
+        std::size_t start = 0;
+        for (std::size_t c = 1; c <= target && start < text.size(); ++c) {
+            std::size_t end = c == target ? text.size() : std::max(start, text.size() * c / target);
+            end = std::min(text.find('\n', end), text.size());
+            end = end < text.size() ? end + 1 : end;
+            chunks.emplace_back();
+            chunks.back().text = text.substr(start, end - start);
+            start = end;
+        }
+
+        // Chunks parse independently; each writes only its own results
+        parallelFor(chunks.size(), workers, [&](std::size_t c) { chunks[c].parse(); });
+
+        // Merge in file order, renumbering names and rows
+        TradeFile<T> result;
+        std::unordered_map<std::string_view, std::uint32_t> globalIndex;
+        std::size_t total = 0;
+        for (const auto& chunk : chunks) total += chunk.tradeIds.size();
+        result.tradeIds.reserve(total);
+        result.underlyingIndex.reserve(total);
+        result.parameters.reserve(total);
+
+        std::size_t lineOffset = lineBase;
+        for (const auto& chunk : chunks) {
+            std::vector<std::uint32_t> remap(chunk.names.size());
+            for (std::size_t n = 0; n < chunk.names.size(); ++n) {
+                auto [it, inserted] = globalIndex.try_emplace(chunk.names[n], static_cast<std::uint32_t>(result.underlyings.size()));
+                if (inserted) result.underlyings.emplace_back(chunk.names[n]);
+                remap[n] = it->second;
+            }
+            result.tradeIds.insert(result.tradeIds.end(), chunk.tradeIds.begin(), chunk.tradeIds.end());
+            for (std::uint32_t local : chunk.underlyingIndex) {
+                result.underlyingIndex.push_back(remap[local]);
+            }
+            result.parameters.insert(result.parameters.end(), chunk.parameters.begin(), chunk.parameters.end());
+            for (const auto& issue : chunk.issues) {
+                result.report.rejected.push_back({ issue.row + lineOffset, issue.message });
+            }
+            lineOffset += chunk.lines;
+        }
+        result.report.loaded = result.parameters.size();
+        return result;
+    }
+
+    template<typename T>
+    TradeFile<T> PortfolioLoader<T>::readCsv(const std::string& path, unsigned threads) {
+        const MappedFile file(path);
+        return parseCsv(std::string_view(reinterpret_cast<const char*>(file.data()), file.size()), threads);
+    }
+
+    template<typename T>
+    TradeFile<T> PortfolioLoader<T>::readBinary(const std::string& path) {
+        const MappedFile file(path);
+        if (file.size() < HeaderSize) {
+            throw std::runtime_error("Trade file too small: " + path);
+        }
+
+        BinaryHeader header;
+        std::memcpy(&header, file.data(), sizeof(BinaryHeader));
+        if (std::memcmp(header.magic, BinaryMagic, sizeof(BinaryMagic)) != 0) {
+            throw std::runtime_error("Not a binary trade file: " + path);
+        }
+        if (header.endianTag != EndianTag) {
+            throw std::runtime_error("Binary trade file has foreign byte order: " + path);
+        }
+        if (header.version != BinaryVersion) {
+            throw std::runtime_error("Unsupported binary trade file version: " + std::to_string(header.version));
+        }
+        if (header.scalarSize != sizeof(T)) {
+            throw std::runtime_error("Binary trade file precision does not match portfolio type");
+        }
+
+        // Every column must be aligned and lie inside the file
+        const std::uint64_t n = header.tradeCount;
+        if (n > file.size()) {
+            throw std::runtime_error("Corrupt binary trade file count: " + path);
+        }
+        const std::uint64_t bytes[ColumnCount] = { header.nameBytes, n * sizeof(std::uint64_t), n * sizeof(std::uint32_t),
+            n, n * sizeof(T), n * sizeof(T), n * sizeof(T), n * sizeof(T) };
+        for (std::size_t c = 0; c < ColumnCount; ++c) {
+            if (header.offsets[c] % Alignment != 0 || header.offsets[c] > file.size() ||
+                bytes[c] > file.size() - header.offsets[c]) {
+                throw std::runtime_error("Corrupt binary trade file column: " + path);
+            }
+        }
+        auto column = [&](std::size_t c) { return file.data() + header.offsets[c]; };
+
+        TradeFile<T> result;
+        const std::string_view names(reinterpret_cast<const char*>(column(0)), header.nameBytes);
+        for (std::size_t position = 0; position < names.size();) {
+            const std::size_t eol = std::min(names.find('\n', position), names.size());
+            result.underlyings.emplace_back(names.substr(position, eol - position));
+            position = eol + 1;
+        }
+
+        // Columns are read in place from the page-aligned mapping
+        const std::size_t count = static_cast<std::size_t>(n);
+        const auto* ids = reinterpret_cast<const std::uint64_t*>(column(1));
+        const auto* underlyings = reinterpret_cast<const std::uint32_t*>(column(2));
+        const auto* flags = reinterpret_cast<const std::uint8_t*>(column(3));
+        const auto* notionals = reinterpret_cast<const T*>(column(4));
+        const auto* strikes = reinterpret_cast<const T*>(column(5));
+        const auto* maturities = reinterpret_cast<const T*>(column(6));
+        const auto* spots = reinterpret_cast<const T*>(column(7));
+
+        // Batch validation over the columns
+        result.tradeIds.reserve(count);
+        result.underlyingIndex.reserve(count);
+        result.parameters.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const typename Instrument<T>::Parameters p{ notionals[i], strikes[i], maturities[i], spots[i], flags[i] != 0 };
+            if (underlyings[i] >= result.underlyings.size()) {
+                result.report.rejected.push_back({ i, "Unknown underlying id" });
+            }
+            else if (const char* error = checkTerms<T>(p)) {
+                result.report.rejected.push_back({ i, error });
+            }
+            else {
+                result.tradeIds.push_back(ids[i]);
+                result.underlyingIndex.push_back(underlyings[i]);
+                result.parameters.push_back(p);
+            }
+        }
+        result.report.loaded = result.parameters.size();
+        return result;
+    }
+
+    template<typename T>
+    void PortfolioLoader<T>::append(const TradeFile<T>& trades, Portfolio<T>& portfolio, const MarketResolver& markets) {
+        // Resolve each distinct underlying once
+        std::vector<typename Portfolio<T>::UnderlyingId> ids(trades.underlyings.size());
+        for (std::size_t n = 0; n < trades.underlyings.size(); ++n) {
+            ids[n] = portfolio.addUnderlying(trades.underlyings[n], markets(trades.underlyings[n]));
+        }
+
+        // Rows were validated while parsing, so these appends cannot throw on terms
+        portfolio.reserve(portfolio.size() + trades.parameters.size());
+        for (std::size_t i = 0; i < trades.parameters.size(); ++i) {
+            portfolio.addTrade(trades.tradeIds[i], ids[trades.underlyingIndex[i]], trades.parameters[i]);
+        }
+    }
+
+    template<typename T>
+    LoadReport PortfolioLoader<T>::loadCsv(const std::string& path, Portfolio<T>& portfolio,
+        const MarketResolver& markets, unsigned threads) {
+        const TradeFile<T> trades = readCsv(path, threads);
+        append(trades, portfolio, markets);
+        return trades.report;
+    }
+
+    template<typename T>
+    LoadReport PortfolioLoader<T>::loadBinary(const std::string& path, Portfolio<T>& portfolio,
+        const MarketResolver& markets) {
+        const TradeFile<T> trades = readBinary(path);
+        append(trades, portfolio, markets);
+        return trades.report;
+    }
+
+    template<typename T>
+    void PortfolioLoader<T>::saveBinary(const Portfolio<T>& portfolio, const std::string& path) {
+        static_assert(sizeof(BinaryHeader) <= HeaderSize, "Trade file header outgrew its reserved space");
+
+        std::string names;
+        for (std::size_t u = 0; u < portfolio.underlyingCount(); ++u) {
+            names += portfolio.underlyingName(static_cast<typename Portfolio<T>::UnderlyingId>(u));
+            names += '\n';
+        }
+
+        BinaryHeader header{};
+        std::memcpy(header.magic, BinaryMagic, sizeof(BinaryMagic));
+        header.version = BinaryVersion;
+        header.endianTag = EndianTag;
+        header.scalarSize = sizeof(T);
+        header.tradeCount = portfolio.size();
+        header.nameBytes = names.size();
+
+        // Column sources in file order
+        const std::size_t n = portfolio.size();
+        const std::pair<const void*, std::uint64_t> columns[ColumnCount] = {
+            { names.data(), names.size() },
+            { portfolio.tradeIds().data(), n * sizeof(std::uint64_t) },
+            { portfolio.underlyings().data(), n * sizeof(std::uint32_t) },
+            { portfolio.isCall().data(), n },
+            { portfolio.notionals().data(), n * sizeof(T) },
+            { portfolio.strikes().data(), n * sizeof(T) },
+            { portfolio.maturities().data(), n * sizeof(T) },
+            { portfolio.spots().data(), n * sizeof(T) },
+        };
+        std::uint64_t position = HeaderSize;
+        for (std::size_t c = 0; c < ColumnCount; ++c) {
+            header.offsets[c] = position;
+            position = alignUp(position + columns[c].second, Alignment);
+        }
+
+        // Write to a side file, then swap it in
+        const std::string tmpPath = path + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                throw std::runtime_error("Cannot write trade file: " + tmpPath);
+            }
+
+            std::vector<char> padding(HeaderSize, 0);
+            std::memcpy(padding.data(), &header, sizeof(BinaryHeader));
+            out.write(padding.data(), HeaderSize);
+
+            std::uint64_t written = HeaderSize;
+            for (std::size_t c = 0; c < ColumnCount; ++c) {
+                // Zero-fill up to the column's aligned start
+                const std::vector<char> gap(header.offsets[c] - written, 0);
+                out.write(gap.data(), static_cast<std::streamsize>(gap.size()));
+                out.write(static_cast<const char*>(columns[c].first), static_cast<std::streamsize>(columns[c].second));
+                written = header.offsets[c] + columns[c].second;
+            }
+            if (!out) {
+                throw std::runtime_error("Failed writing trade file: " + tmpPath);
+            }
+        }
+        std::filesystem::rename(tmpPath, path);
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class PortfolioLoader<double>;
+    template class PortfolioLoader<float>;
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+// Same project headers.
+#include "Core/PriceStore.h"
+#include "Core/ResponseCache.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace QuantEngine {
+    namespace {
+        constexpr char ColumnMagic[8] = { 'Q', 'E', 'P', 'R', 'I', 'C', 'E', '1' };
+        constexpr std::uint32_t EndianTag = 0x01020304u;
+        constexpr const char* ColumnFiles[PriceStore::ColumnCount] = {
+            "date.col", "open.col", "high.col", "low.col", "close.col", "volume.col" };
+
+        std::size_t valueSize(std::uint32_t column) {
+            return column == PriceStore::Date ? sizeof(std::uint32_t) : sizeof(double);
+        }
+
+        // Raw values of one column of bars
+        const char* columnData(const PriceStore::Bars& bars, std::uint32_t column) {
+            const std::span<const double> values[] = { bars.opens, bars.highs, bars.lows, bars.closes, bars.volumes };
+            return column == PriceStore::Date ? reinterpret_cast<const char*>(bars.dates.data())
+                : reinterpret_cast<const char*>(values[column - 1].data());
+        }
+
+        // Equal column lengths and strictly ascending dates
+        void validate(const PriceStore::Bars& bars) {
+            const std::size_t n = bars.dates.size();
+            if (bars.opens.size() != n || bars.highs.size() != n || bars.lows.size() != n ||
+                bars.closes.size() != n || bars.volumes.size() != n) {
+                throw std::invalid_argument("Daily bar columns must have equal lengths");
+            }
+            for (std::size_t i = 1; i < n; ++i) {
+                if (bars.dates[i] <= bars.dates[i - 1]) {
+                    throw std::invalid_argument("Daily bars must be in ascending date order");
+                }
+            }
+        }
+
+        // Days since 1970-01-01 for a YYYYMMDD date
+        std::int64_t dayNumber(std::uint32_t date) {
+            const std::chrono::year_month_day ymd{ std::chrono::year(static_cast<int>(date / 10000)),
+                std::chrono::month(date / 100 % 100), std::chrono::day(date % 100) };
+            return std::chrono::sys_days(ymd).time_since_epoch().count();
+        }
+
+        // 1970-01-01 was a Thursday; weekday 0 = Sunday, 6 = Saturday
+        bool isWeekend(std::int64_t day) {
+            const std::int64_t weekday = ((day + 4) % 7 + 7) % 7;
+            return weekday == 0 || weekday == 6;
+        }
+    }
+
+    PriceStore::PriceStore(std::filesystem::path directory) : directory_(std::move(directory)) {}
+
+    std::filesystem::path PriceStore::symbolPath(const std::string& symbol) const {
+        if (symbol.empty()) {
+            throw std::invalid_argument("Price store needs a symbol");
+        }
+
+        // Anything beyond letters, digits, '-' and '_' (or a leading '.') becomes '_'
+        std::string name = symbol;
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            const char c = name[i];
+            const bool keep = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                c == '-' || c == '_' || (c == '.' && i > 0);
+            if (!keep) name[i] = '_';
+        }
+        return directory_ / name;
+    }
+
+    PriceStore::Series PriceStore::read(const std::string& symbol) const {
+        const auto path = symbolPath(symbol);
+        Series series;
+        std::size_t rows = SIZE_MAX;
+        for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+            const auto file = path / ColumnFiles[c];
+            if (!std::filesystem::exists(file)) {
+                return {};
+            }
+            series.files_[c] = std::make_shared<const MappedFile>(file.string());
+
+            // Validate the header before trusting the values
+            const MappedFile& mapped = *series.files_[c];
+            Header header;
+            if (mapped.size() < HeaderSize) {
+                throw std::runtime_error("Corrupt price store column: " + file.string());
+            }
+            std::memcpy(&header, mapped.data(), sizeof(Header));
+            if (std::memcmp(header.magic, ColumnMagic, sizeof(ColumnMagic)) != 0 || header.column != c ||
+                header.valueSize != valueSize(c)) {
+                throw std::runtime_error("Corrupt price store column: " + file.string());
+            }
+            if (header.endianTag != EndianTag) {
+                throw std::runtime_error("Price store column has foreign byte order: " + file.string());
+            }
+            if (header.version != FormatVersion) {
+                throw std::runtime_error("Unsupported price store version: " + std::to_string(header.version));
+            }
+            rows = std::min(rows, (mapped.size() - HeaderSize) / header.valueSize);
+        }
+
+        const auto start = [&](std::uint32_t c) { return series.files_[c]->data() + HeaderSize; };
+        series.dates_ = std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t*>(start(Date)), rows);
+        for (std::uint32_t c = Open; c < ColumnCount; ++c) {
+            series.values_[c - 1] = std::span<const double>(reinterpret_cast<const double*>(start(c)), rows);
+        }
+        return series;
+    }
+
+    void PriceStore::writeColumns(const std::filesystem::path& directory, const Bars& bars, std::size_t first) {
+        std::filesystem::create_directories(directory);
+
+        // Rows every column already holds; anything past them is a torn append
+        std::size_t committed = SIZE_MAX;
+        for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+            const auto file = directory / ColumnFiles[c];
+            const std::uintmax_t bytes = std::filesystem::exists(file) ? std::filesystem::file_size(file) : 0;
+            committed = std::min<std::size_t>(committed, bytes > HeaderSize ? (bytes - HeaderSize) / valueSize(c) : 0);
+        }
+
+        for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+            const auto file = directory / ColumnFiles[c];
+            const std::size_t size = valueSize(c);
+            if (!std::filesystem::exists(file) || std::filesystem::file_size(file) < HeaderSize) {
+                Header header{};
+                std::memcpy(header.magic, ColumnMagic, sizeof(ColumnMagic));
+                header.version = FormatVersion;
+                header.endianTag = EndianTag;
+                header.column = c;
+                header.valueSize = static_cast<std::uint32_t>(size);
+
+                std::vector<char> padding(HeaderSize, 0);
+                std::memcpy(padding.data(), &header, sizeof(Header));
+                std::ofstream(file, std::ios::binary | std::ios::trunc).write(padding.data(), HeaderSize);
+            }
+            else if (std::filesystem::file_size(file) > HeaderSize + committed * size) {
+                std::filesystem::resize_file(file, HeaderSize + committed * size);
+            }
+
+            std::ofstream out(file, std::ios::binary | std::ios::app);
+            out.write(columnData(bars, c) + first * size,
+                static_cast<std::streamsize>((bars.dates.size() - first) * size));
+            if (!out) {
+                throw std::runtime_error("Failed writing price store column: " + file.string());
+            }
+        }
+    }
+
+    std::size_t PriceStore::append(const std::string& symbol, const Bars& bars) {
+        validate(bars);
+        std::lock_guard<std::mutex> lock(writeMutex_);
+
+        // Only sessions after the stored history are new
+        const std::uint32_t lastDate = read(symbol).lastDate();
+        const std::size_t first = static_cast<std::size_t>(
+            std::upper_bound(bars.dates.begin(), bars.dates.end(), lastDate) - bars.dates.begin());
+        if (first == bars.dates.size()) {
+            return 0;
+        }
+        writeColumns(symbolPath(symbol), bars, first);
+        return bars.dates.size() - first;
+    }
+
+    void PriceStore::replace(const std::string& symbol, const Bars& bars) {
+        validate(bars);
+        std::lock_guard<std::mutex> lock(writeMutex_);
+
+        // Build the new history beside the old one, then swap the directories
+        // ('~' never appears in a symbol directory name)
+        const auto path = symbolPath(symbol);
+        const auto fresh = directory_ / ("~" + path.filename().string() + ".new");
+        const auto stale = directory_ / ("~" + path.filename().string() + ".old");
+        std::filesystem::remove_all(fresh);
+        writeColumns(fresh, bars, 0);
+
+        std::filesystem::remove_all(stale);
+        if (std::filesystem::exists(path)) {
+            std::filesystem::rename(path, stale);
+        }
+        std::filesystem::rename(fresh, path);
+        std::filesystem::remove_all(stale);
+    }
+
+    void PriceStore::clear() {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        std::error_code ignored;
+        std::filesystem::remove_all(directory_, ignored);
+    }
+
+    std::uint32_t PriceStore::lastCompletedSession(Clock::time_point now) {
+        const std::int64_t secondsPerDay = 24 * 60 * 60;
+        const std::int64_t seconds = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+        std::int64_t day = (seconds >= 0 ? seconds : seconds - secondsPerDay + 1) / secondsPerDay;
+
+        // Today only counts once its close has passed
+        if (seconds < day * secondsPerDay + std::chrono::seconds(ResponseCache::DailyCloseUtc).count()) {
+            --day;
+        }
+        while (isWeekend(day)) {
+            --day;
+        }
+
+        const std::chrono::year_month_day ymd{ std::chrono::sys_days(std::chrono::days(day)) };
+        return static_cast<std::uint32_t>(static_cast<int>(ymd.year()) * 10000 +
+            static_cast<unsigned>(ymd.month()) * 100 + static_cast<unsigned>(ymd.day()));
+    }
+
+    std::size_t PriceStore::sessionsBetween(std::uint32_t from, std::uint32_t to) {
+        std::size_t sessions = 0;
+        for (std::int64_t day = dayNumber(from) + 1, last = dayNumber(to); day <= last; ++day) {
+            if (!isWeekend(day)) ++sessions;
+        }
+        return sessions;
+    }
+}
\ No newline at end of file
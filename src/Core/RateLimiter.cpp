@@ -0,0 +1,71 @@
+// Same project headers.
+#include "Core/RateLimiter.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+namespace QuantEngine {
+    RateLimiter::RateLimiter(double ratePerSecond, double burst)
+        : rate_(ratePerSecond), burst_(burst), tokens_(burst), updated_(Clock::now()) {
+        if (!(ratePerSecond > 0) || !(burst > 0)) {
+            throw std::invalid_argument("Rate limiter needs a positive rate and burst");
+        }
+    }
+
+    double RateLimiter::tokensAt(Clock::time_point now) const {
+        // Refill since the last update; a clock reading older than the last update adds nothing
+        const double elapsed = std::max(0.0, std::chrono::duration<double>(now - updated_).count());
+        return std::min(burst_, tokens_ + elapsed * rate_);
+    }
+
+    RateLimiter::Clock::time_point RateLimiter::reserve(Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tokens_ = tokensAt(now) - 1;
+        updated_ = std::max(updated_, now);
+
+        // A negative balance is the queue ahead of us; our token arrives once it is paid back
+        const double wait = tokens_ >= 0 ? 0.0 : -tokens_ / rate_;
+        ++metrics_.granted;
+        metrics_.totalWaitSeconds += wait;
+        metrics_.maxWaitSeconds = std::max(metrics_.maxWaitSeconds, wait);
+        return now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(wait));
+    }
+
+    RateLimiter::Clock::duration RateLimiter::acquire() {
+        const auto now = Clock::now();
+        const auto due = reserve(now);
+        std::this_thread::sleep_until(due);
+        return due - now;
+    }
+
+    RateLimiter::Clock::duration RateLimiter::waitEstimate(Clock::time_point now) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const double after = tokensAt(now) - 1;
+        const double wait = after >= 0 ? 0.0 : -after / rate_;
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(wait));
+    }
+
+    bool RateLimiter::tryAcquire(Clock::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const double available = tokensAt(now);
+        if (available < 1) {
+            return false;
+        }
+        tokens_ = available - 1;
+        updated_ = std::max(updated_, now);
+        ++metrics_.granted;
+        return true;
+    }
+
+    RateLimiter::Metrics RateLimiter::metrics(Clock::time_point now) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Metrics snapshot = metrics_;
+        const double available = tokensAt(now);
+        snapshot.queueDepth = available < 0 ? static_cast<std::size_t>(std::ceil(-available)) : 0;
+        return snapshot;
+    }
+}
\ No newline at end of file
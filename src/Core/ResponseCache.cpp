@@ -0,0 +1,211 @@
+// Same project headers.
+#include "Core/ResponseCache.h"
+// 3rd party headers.
+#include <zlib.h>
+// std headers.
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace QuantEngine {
+    namespace {
+        constexpr char CacheMagic[8] = { 'Q', 'E', 'H', 'T', 'T', 'P', 'C', '1' };
+        constexpr std::int64_t SecondsPerDay = 24 * 60 * 60;
+
+        // Query parameters that carry credentials and never belong in a key
+        bool isCredential(std::string_view name) {
+            return name == "apikey" || name == "api_key";
+        }
+
+        // Value of query parameter name in url, empty if absent
+        std::string queryValue(const std::string& url, std::string_view name) {
+            const auto query = url.find('?');
+            if (query == std::string::npos) {
+                return {};
+            }
+            std::size_t start = query + 1;
+            while (start < url.size()) {
+                const std::size_t end = std::min(url.find('&', start), url.size());
+                const std::string_view param(url.data() + start, end - start);
+                const auto eq = param.find('=');
+                if (param.substr(0, eq) == name) {
+                    return eq == std::string_view::npos ? std::string() : std::string(param.substr(eq + 1));
+                }
+                start = end + 1;
+            }
+            return {};
+        }
+
+        // Next weekday DailyCloseUtc strictly after now
+        std::int64_t nextClose(std::int64_t now) {
+            const std::int64_t closeOffset = std::chrono::seconds(ResponseCache::DailyCloseUtc).count();
+            std::int64_t day = (now >= 0 ? now : now - SecondsPerDay + 1) / SecondsPerDay;
+            if (now >= day * SecondsPerDay + closeOffset) {
+                ++day;
+            }
+            // 1970-01-01 was a Thursday; weekday 0 = Sunday, 6 = Saturday
+            while ((day + 4) % 7 == 0 || (day + 4) % 7 == 6) {
+                ++day;
+            }
+            return day * SecondsPerDay + closeOffset;
+        }
+    }
+
+    ResponseCache::ResponseCache(std::filesystem::path directory) : directory_(std::move(directory)) {}
+
+    std::string ResponseCache::normalize(const std::string& url) {
+        const auto query = url.find('?');
+        std::string key = url.substr(0, query);
+        if (query == std::string::npos) {
+            return key;
+        }
+
+        // Collect non-credential parameters and order them by name (stable for equal names)
+        std::vector<std::string_view> params;
+        std::size_t start = query + 1;
+        while (start <= url.size()) {
+            const std::size_t end = std::min(url.find('&', start), url.size());
+            const std::string_view param(url.data() + start, end - start);
+            if (!param.empty() && !isCredential(param.substr(0, param.find('=')))) {
+                params.push_back(param);
+            }
+            start = end + 1;
+        }
+        std::stable_sort(params.begin(), params.end(), [](std::string_view a, std::string_view b) {
+            return a.substr(0, a.find('=')) < b.substr(0, b.find('='));
+        });
+
+        for (std::size_t i = 0; i < params.size(); ++i) {
+            key += i == 0 ? '?' : '&';
+            key += params[i];
+        }
+        return key;
+    }
+
+    std::uint64_t ResponseCache::keyHash(std::string_view key) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : key) {
+            hash = (hash ^ c) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::chrono::seconds ResponseCache::timeToLive(const std::string& url, Clock::time_point now) {
+        if (url.find("alphavantage.co") != std::string::npos) {
+            const std::string function = queryValue(url, "function");
+            if (function == "GLOBAL_QUOTE") {
+                return QuoteTtl;
+            }
+            if (function == "TIME_SERIES_DAILY") {
+                const std::int64_t seconds = std::chrono::duration_cast<std::chrono::seconds>(
+                    now.time_since_epoch()).count();
+                return std::chrono::seconds(nextClose(seconds) - seconds);
+            }
+            return std::chrono::seconds(0);
+        }
+        if (url.find("api.stlouisfed.org") != std::string::npos) {
+            return RateTtl;
+        }
+        return std::chrono::seconds(0);
+    }
+
+    std::filesystem::path ResponseCache::entryPath(const std::string& key) const {
+        std::ostringstream name;
+        // The hash only names the file; the full key is checked on lookup
+        name << std::hex << std::setw(16) << std::setfill('0') << keyHash(key) << ".qec";
+        return directory_ / name.str();
+    }
+
+    std::optional<std::string> ResponseCache::lookup(const std::string& url, Clock::time_point now) const {
+        const std::string key = normalize(url);
+        std::ifstream in(entryPath(key), std::ios::binary);
+        if (!in) {
+            return std::nullopt;
+        }
+
+        // Header, then the key to rule out hash collisions
+        Header header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(Header)) ||
+            std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0 || header.keySize != key.size()) {
+            return std::nullopt;
+        }
+        if (std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count() >= header.expiresAt) {
+            return std::nullopt;
+        }
+        std::string storedKey(key.size(), '\0');
+        if (!in.read(storedKey.data(), static_cast<std::streamsize>(storedKey.size())) || storedKey != key) {
+            return std::nullopt;
+        }
+
+        // Rest of the file is the compressed body
+        // Deflate expands at most ~1032:1, so a larger claimed size is corruption, not something to allocate
+        const std::vector<char> compressed((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (header.bodySize > (compressed.size() + 1) * MaxCompressionRatio) {
+            return std::nullopt;
+        }
+        std::string body(header.bodySize, '\0');
+        uLongf bodySize = static_cast<uLongf>(header.bodySize);
+        if (uncompress(reinterpret_cast<Bytef*>(body.data()), &bodySize,
+            reinterpret_cast<const Bytef*>(compressed.data()), static_cast<uLong>(compressed.size())) != Z_OK ||
+            bodySize != header.bodySize) {
+            return std::nullopt;
+        }
+        return body;
+    }
+
+    void ResponseCache::store(const std::string& url, std::string_view body, Clock::time_point now) {
+        const auto ttl = timeToLive(url, now);
+        if (ttl.count() <= 0) {
+            return;
+        }
+
+        const std::string key = normalize(url);
+        Header header{};
+        std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+        header.expiresAt = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count() + ttl.count();
+        header.keySize = key.size();
+        header.bodySize = body.size();
+
+        uLongf compressedSize = compressBound(static_cast<uLong>(body.size()));
+        std::vector<Bytef> compressed(compressedSize);
+        if (compress2(compressed.data(), &compressedSize, reinterpret_cast<const Bytef*>(body.data()),
+            static_cast<uLong>(body.size()), Z_BEST_SPEED) != Z_OK) {
+            throw std::runtime_error("Failed to compress cached response for " + key);
+        }
+
+        // Side file unique to this writer, then swap it in
+        static std::atomic<std::uint64_t> writeCounter{ 0 };
+        std::filesystem::create_directories(directory_);
+        const auto path = entryPath(key);
+        std::ostringstream suffix;
+        suffix << ".tmp" << std::hash<std::thread::id>{}(std::this_thread::get_id()) << '_' << writeCounter++;
+        const auto tmpPath = path.string() + suffix.str();
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            out.write(key.data(), static_cast<std::streamsize>(key.size()));
+            out.write(reinterpret_cast<const char*>(compressed.data()), static_cast<std::streamsize>(compressedSize));
+            if (!out) {
+                throw std::runtime_error("Failed writing cached response: " + tmpPath);
+            }
+        }
+        std::filesystem::rename(tmpPath, path);
+    }
+
+    void ResponseCache::clear() {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory_, ec)) {
+            if (entry.path().extension() == ".qec") {
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+    }
+}
\ No newline at end of file
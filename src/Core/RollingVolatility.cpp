@@ -0,0 +1,157 @@
+// Same project headers.
+#include "Core/RollingVolatility.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace QuantEngine {
+    template<typename T>
+    RollingVolatility<T>::RollingVolatility(std::vector<std::size_t> windows) {
+        if (windows.empty()) {
+            throw std::invalid_argument("Rolling volatility needs at least one window");
+        }
+        std::size_t longest = 0;
+        for (std::size_t length : windows) {
+            if (length < 2) {
+                throw std::invalid_argument("Rolling volatility windows need at least two returns");
+            }
+            windows_.push_back(Window{ length });
+            longest = std::max(longest, length);
+        }
+        returns_.assign(longest, T(0));
+    }
+
+    template<typename T>
+    T RollingVolatility<T>::returnAt(std::size_t age) const {
+        return returns_[(written_ - 1 - age) % returns_.size()];
+    }
+
+    template<typename T>
+    void RollingVolatility<T>::refresh(Window& window) const {
+        T sum = 0;
+        for (std::size_t i = 0; i < window.count; ++i) {
+            sum += returnAt(i);
+        }
+        window.mean = sum / static_cast<T>(window.count);
+        window.m2 = 0;
+        for (std::size_t i = 0; i < window.count; ++i) {
+            const T deviation = returnAt(i) - window.mean;
+            window.m2 += deviation * deviation;
+        }
+        window.sinceRefresh = 0;
+    }
+
+    template<typename T>
+    void RollingVolatility<T>::update(T close) {
+        if (!(close > 0)) {
+            throw std::invalid_argument("Closes must be positive");
+        }
+        previousClose_ = lastClose_;
+        lastClose_ = close;
+        if (closes_++ == 0) {
+            return;
+        }
+
+        const T value = std::log(close / previousClose_);
+        for (Window& window : windows_) {
+            if (window.count < window.length) {
+                // Window still filling: Welford insertion
+                ++window.count;
+                const T delta = value - window.mean;
+                window.mean += delta / static_cast<T>(window.count);
+                window.m2 += delta * (value - window.mean);
+            }
+            else {
+                // Full window: the oldest return leaves as the new one enters
+                const T leaving = returnAt(window.length - 1);
+                const T oldMean = window.mean;
+                window.mean += (value - leaving) / static_cast<T>(window.length);
+                window.m2 += (value - leaving) * (value - window.mean + leaving - oldMean);
+            }
+        }
+
+        returns_[written_++ % returns_.size()] = value;
+        for (Window& window : windows_) {
+            if (++window.sinceRefresh >= window.length) {
+                refresh(window);
+            }
+        }
+    }
+
+    template<typename T>
+    void RollingVolatility<T>::update(std::span<const T> closes) {
+        for (T close : closes) {
+            update(close);
+        }
+    }
+
+    template<typename T>
+    void RollingVolatility<T>::revise(T close) {
+        if (closes_ < 2) {
+            throw std::logic_error("Revising a close needs two closes first");
+        }
+        if (!(close > 0)) {
+            throw std::invalid_argument("Closes must be positive");
+        }
+
+        // The newest return is in every window; swap its value in place
+        const T value = std::log(close / previousClose_);
+        const T replaced = returnAt(0);
+        returns_[(written_ - 1) % returns_.size()] = value;
+        for (Window& window : windows_) {
+            const T oldMean = window.mean;
+            window.mean += (value - replaced) / static_cast<T>(window.count);
+            window.m2 += (value - replaced) * (value - window.mean + replaced - oldMean);
+            if (++window.sinceRefresh >= window.length) {
+                refresh(window);
+            }
+        }
+        lastClose_ = close;
+    }
+
+    template<typename T>
+    const typename RollingVolatility<T>::Window& RollingVolatility<T>::find(std::size_t window) const {
+        for (const Window& candidate : windows_) {
+            if (candidate.length == window) {
+                return candidate;
+            }
+        }
+        throw std::invalid_argument("Window not tracked: " + std::to_string(window));
+    }
+
+    template<typename T>
+    T RollingVolatility<T>::volatility(std::size_t window) const {
+        const Window& tracked = find(window);
+        if (tracked.count < 2) {
+            throw std::runtime_error("Not enough price data to calculate volatility");
+        }
+
+        // Cancellation can leave m2 a hair below zero for flat series
+        const T variance = std::max(T(0), tracked.m2) / static_cast<T>(tracked.count - 1);
+        return std::sqrt(variance * TradingDays);
+    }
+
+    template<typename T>
+    std::size_t RollingVolatility<T>::observations(std::size_t window) const {
+        return find(window).count;
+    }
+
+    template<typename T>
+    void RollingVolatility<T>::reset() {
+        for (Window& window : windows_) {
+            window = Window{ window.length };
+        }
+        written_ = 0;
+        closes_ = 0;
+        lastClose_ = 0;
+        previousClose_ = 0;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class RollingVolatility<double>;
+    template class RollingVolatility<float>;
+}
\ No newline at end of file
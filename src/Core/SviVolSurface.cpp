@@ -0,0 +1,466 @@
+// Same project headers.
+#include "Core/SviVolSurface.h"
+#include "Core/ParallelFor.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace QuantEngine {
+    namespace {
+        // Result of the inner linear fit for a fixed (m, sigma)
+        struct InnerFit {
+            double a, d, c;     // w = a + d*y + c*sqrt(y^2 + 1), y = (k - m)/sigma
+            double error;       // Sum of squared total-variance residuals
+        };
+
+        // Solves the 3x3 normal equations for (a, d, c) then projects onto the no-arbitrage domain:
+        // c >= 0, |d| <= c, c + |d| <= 2*sigma (Lee), a + sqrt(c^2 - d^2) >= 0 (positive variance)
+        InnerFit fitLinear(const std::vector<double>& k, const std::vector<double>& w,
+            double m, double sigma) {
+            const std::size_t n = k.size();
+            std::vector<double> y(n), z(n);
+            std::array<std::array<double, 4>, 3> A{};
+            for (std::size_t j = 0; j < n; ++j) {
+                y[j] = (k[j] - m) / sigma;
+                z[j] = std::sqrt(y[j] * y[j] + 1.0);
+                const double basis[3] = { 1.0, y[j], z[j] };
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) {
+                        A[r][c] += basis[r] * basis[c];
+                    }
+                    A[r][3] += basis[r] * w[j];
+                }
+            }
+
+            // Gaussian elimination with partial pivoting
+            std::array<double, 3> x{};
+            bool singular = false;
+            for (int col = 0; col < 3 && !singular; ++col) {
+                int pivot = col;
+                for (int r = col + 1; r < 3; ++r) {
+                    if (std::abs(A[r][col]) > std::abs(A[pivot][col])) pivot = r;
+                }
+                if (std::abs(A[pivot][col]) < 1e-14) {
+                    singular = true;
+                    break;
+                }
+                std::swap(A[col], A[pivot]);
+                for (int r = col + 1; r < 3; ++r) {
+                    const double f = A[r][col] / A[col][col];
+                    for (int c = col; c < 4; ++c) A[r][c] -= f * A[col][c];
+                }
+            }
+            if (!singular) {
+                for (int r = 2; r >= 0; --r) {
+                    double acc = A[r][3];
+                    for (int c = r + 1; c < 3; ++c) acc -= A[r][c] * x[c];
+                    x[r] = acc / A[r][r];
+                }
+            }
+
+            // Project slope terms onto the admissible region
+            double c = std::clamp(singular ? 0.0 : x[2], 0.0, 2.0 * sigma);
+            double d = std::clamp(singular ? 0.0 : x[1], -c, c);
+            if (c + std::abs(d) > 2.0 * sigma) {
+                d = std::copysign(2.0 * sigma - c, d);
+            }
+
+            // Refit the level for the projected slopes, keeping minimum variance non-negative
+            double a = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+                a += w[j] - d * y[j] - c * z[j];
+            }
+            a = std::max(a / static_cast<double>(n), -std::sqrt(std::max(c * c - d * d, 0.0)));
+
+            double error = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+                const double r = a + d * y[j] + c * z[j] - w[j];
+                error += r * r;
+            }
+            return { a, d, c, error };
+        }
+
+        // Linear interpolation weight of t inside [t0, t1]
+        template<typename T>
+        T weight(T t, T t0, T t1) {
+            return (t - t0) / (t1 - t0);
+        }
+    }
+
+    // ----- SviParameters -----
+
+    template<typename T>
+    T SviParameters<T>::totalVariance(T k) const {
+        const T x = k - m;
+        return a + b * (rho * x + std::sqrt(x * x + sigma * sigma));
+    }
+
+    template<typename T>
+    void SviParameters<T>::validate() const {
+        if (b < 0 || sigma <= 0 || std::abs(rho) >= 1) {
+            throw std::invalid_argument("Invalid SVI parameters");
+        }
+        // Minimum of the smile must not be negative
+        if (a + b * sigma * std::sqrt(1 - rho * rho) < 0) {
+            throw std::invalid_argument("SVI slice admits negative variance");
+        }
+        // Roger Lee moment bound on wing slopes (small tolerance for rounding)
+        if (b * (1 + std::abs(rho)) > 2 + 1e-6) {
+            throw std::invalid_argument("SVI wings breach Lee's moment bound");
+        }
+    }
+
+    // ----- SviVolSurface -----
+
+    template<typename T>
+    SviVolSurface<T>::SviVolSurface(std::vector<T> maturities, std::vector<T> forwards,
+        std::vector<SviParameters<T>> slices)
+        : maturities_(std::move(maturities)), forwards_(std::move(forwards)) {
+        if (maturities_.empty() || maturities_.size() != forwards_.size() ||
+            maturities_.size() != slices.size()) {
+            throw std::invalid_argument("SVI surface needs matching, non-empty slice arrays");
+        }
+
+        const std::size_t n = maturities_.size();
+        logForwards_.resize(n);
+        a_.resize(n); b_.resize(n); rho_.resize(n); m_.resize(n); sigma_.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (maturities_[i] <= 0 || (i > 0 && maturities_[i] <= maturities_[i - 1])) {
+                throw std::invalid_argument("SVI maturities must be positive and increasing");
+            }
+            if (forwards_[i] <= 0) {
+                throw std::invalid_argument("SVI forwards must be positive");
+            }
+            slices[i].validate();
+
+            // Store column-wise for evaluation
+            logForwards_[i] = std::log(forwards_[i]);
+            a_[i] = slices[i].a;
+            b_[i] = slices[i].b;
+            rho_[i] = slices[i].rho;
+            m_[i] = slices[i].m;
+            sigma_[i] = slices[i].sigma;
+        }
+    }
+
+    template<typename T>
+    SviParameters<T> SviVolSurface<T>::slice(std::size_t i) const {
+        return { a_[i], b_[i], rho_[i], m_[i], sigma_[i] };
+    }
+
+    template<typename T>
+    T SviVolSurface<T>::sliceVariance(std::size_t i, T k) const {
+        const T x = k - m_[i];
+        return a_[i] + b_[i] * (rho_[i] * x + std::sqrt(x * x + sigma_[i] * sigma_[i]));
+    }
+
+    template<typename T>
+    std::size_t SviVolSurface<T>::locate(T maturity, T& alpha, T& scale) const {
+        const std::size_t last = maturities_.size() - 1;
+        alpha = T(0);
+        scale = T(1);
+
+        // Constant implied volatility outside the calibrated maturities
+        if (maturity <= maturities_.front()) {
+            scale = maturity / maturities_.front();
+            return 0;
+        }
+        if (maturity >= maturities_[last]) {
+            scale = maturity / maturities_[last];
+            return last;
+        }
+
+        // Bracketing slices for linear-in-time interpolation
+        const std::size_t hi = static_cast<std::size_t>(
+            std::upper_bound(maturities_.begin(), maturities_.end(), maturity) - maturities_.begin());
+        alpha = weight(maturity, maturities_[hi - 1], maturities_[hi]);
+        return hi - 1;
+    }
+
+    template<typename T>
+    T SviVolSurface<T>::totalVariance(T k, T maturity) const {
+        T alpha, scale;
+        const std::size_t i = locate(maturity, alpha, scale);
+        const T w = alpha > 0 ? (1 - alpha) * sliceVariance(i, k) + alpha * sliceVariance(i + 1, k)
+            : sliceVariance(i, k);
+        return w * scale;
+    }
+
+    template<typename T>
+    T SviVolSurface<T>::volatility(T strike, T maturity) const {
+        if (strike <= 0) {
+            throw std::invalid_argument("Strike must be positive");
+        }
+        const T t = maturity > 0 ? maturity : maturities_.front();
+
+        // Log-forward and total variance share one bracket search
+        T alpha, scale;
+        const std::size_t i = locate(t, alpha, scale);
+        T w;
+        if (alpha > 0) {
+            const T k = std::log(strike) - ((1 - alpha) * logForwards_[i] + alpha * logForwards_[i + 1]);
+            w = (1 - alpha) * sliceVariance(i, k) + alpha * sliceVariance(i + 1, k);
+        }
+        else {
+            w = sliceVariance(i, std::log(strike) - logForwards_[i]) * scale;
+        }
+        return std::sqrt(std::max(w, T(0)) / t);
+    }
+
+    template<typename T>
+    bool SviVolSurface<T>::isCalendarArbitrageFree(const std::vector<T>& logMoneyness) const {
+        // Total variance must not decrease from one slice to the next at any tested moneyness
+        for (std::size_t i = 1; i < maturities_.size(); ++i) {
+            for (T k : logMoneyness) {
+                if (sliceVariance(i, k) < sliceVariance(i - 1, k) - T(1e-10)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    SviParameters<T> SviVolSurface<T>::calibrateSlice(const SviSliceQuotes<T>& quotes,
+        const SviParameters<T>* initialGuess) {
+        if (quotes.maturity <= 0 || quotes.forward <= 0) {
+            throw std::invalid_argument("SVI slice needs positive maturity and forward");
+        }
+        if (quotes.strikes.size() != quotes.vols.size() || quotes.strikes.size() < 3) {
+            throw std::invalid_argument("SVI slice needs at least three strike/vol quotes");
+        }
+
+        // Convert quotes to (log-moneyness, total variance), calibrating in double
+        const std::size_t n = quotes.strikes.size();
+        std::vector<double> k(n), w(n);
+        for (std::size_t j = 0; j < n; ++j) {
+            if (quotes.strikes[j] <= 0 || quotes.vols[j] < 0) {
+                throw std::invalid_argument("Invalid strike/volatility quote");
+            }
+            k[j] = std::log(static_cast<double>(quotes.strikes[j]) / quotes.forward);
+            w[j] = static_cast<double>(quotes.vols[j]) * quotes.vols[j] * quotes.maturity;
+        }
+        const auto [kMin, kMax] = std::minmax_element(k.begin(), k.end());
+        const double lo = *kMin - 1.0, hi = *kMax + 1.0;
+
+        // Outer objective over p = (m, ln sigma) with m kept near the quoted range
+        auto objective = [&](const std::array<double, 2>& p) {
+            const double m = std::clamp(p[0], lo, hi);
+            const double sigma = std::clamp(std::exp(p[1]), 1e-4, 10.0);
+            return fitLinear(k, w, m, sigma).error;
+        };
+
+        // Warm start from a previous fit, otherwise centre on the smile minimum
+        std::array<double, 2> start;
+        if (initialGuess) {
+            start = { static_cast<double>(initialGuess->m),
+                      std::log(std::max(static_cast<double>(initialGuess->sigma), 1e-4)) };
+        }
+        else {
+            const std::size_t argMin = static_cast<std::size_t>(
+                std::min_element(w.begin(), w.end()) - w.begin());
+            start = { k[argMin], std::log(0.1) };
+        }
+
+        // Nelder-Mead simplex on the two nonlinear parameters
+        std::array<std::array<double, 2>, 3> simplex{ start, start, start };
+        simplex[1][0] += initialGuess ? 0.02 : 0.1;
+        simplex[2][1] += initialGuess ? 0.1 : 0.5;
+        std::array<double, 3> f{ objective(simplex[0]), objective(simplex[1]), objective(simplex[2]) };
+
+        for (int iter = 0; iter < 400; ++iter) {
+            // Order vertices best to worst
+            std::array<int, 3> idx{ 0, 1, 2 };
+            std::sort(idx.begin(), idx.end(), [&f](int l, int r) { return f[l] < f[r]; });
+            const int best = idx[0], mid = idx[1], worst = idx[2];
+            if (f[worst] - f[best] <= 1e-16 * (1.0 + f[best])) {
+                break;
+            }
+
+            std::array<double, 2> centroid{ (simplex[best][0] + simplex[mid][0]) / 2,
+                                            (simplex[best][1] + simplex[mid][1]) / 2 };
+            auto along = [&](double t) {
+                return std::array<double, 2>{ centroid[0] + t * (simplex[worst][0] - centroid[0]),
+                                              centroid[1] + t * (simplex[worst][1] - centroid[1]) };
+            };
+
+            // Reflect, expand, contract or shrink
+            const auto reflected = along(-1.0);
+            const double fr = objective(reflected);
+            if (fr < f[best]) {
+                const auto expanded = along(-2.0);
+                const double fe = objective(expanded);
+                if (fe < fr) { simplex[worst] = expanded; f[worst] = fe; }
+                else { simplex[worst] = reflected; f[worst] = fr; }
+            }
+            else if (fr < f[mid]) {
+                simplex[worst] = reflected; f[worst] = fr;
+            }
+            else {
+                const auto contracted = along(0.5);
+                const double fc = objective(contracted);
+                if (fc < f[worst]) {
+                    simplex[worst] = contracted; f[worst] = fc;
+                }
+                else {
+                    for (int v : { mid, worst }) {
+                        simplex[v][0] = simplex[best][0] + 0.5 * (simplex[v][0] - simplex[best][0]);
+                        simplex[v][1] = simplex[best][1] + 0.5 * (simplex[v][1] - simplex[best][1]);
+                        f[v] = objective(simplex[v]);
+                    }
+                }
+            }
+        }
+
+        // Recover raw SVI parameters from the best vertex
+        const int best = static_cast<int>(std::min_element(f.begin(), f.end()) - f.begin());
+        const double m = std::clamp(simplex[best][0], lo, hi);
+        const double sigma = std::clamp(std::exp(simplex[best][1]), 1e-4, 10.0);
+        const InnerFit fit = fitLinear(k, w, m, sigma);
+
+        SviParameters<T> result;
+        result.a = static_cast<T>(fit.a);
+        result.b = static_cast<T>(fit.c / sigma);
+        result.rho = static_cast<T>(fit.c > 0 ? std::clamp(fit.d / fit.c, -0.999, 0.999) : 0.0);
+        result.m = static_cast<T>(m);
+        result.sigma = static_cast<T>(sigma);
+        return result;
+    }
+
+    template<typename T>
+    SviVolSurface<T> SviVolSurface<T>::calibrate(const std::vector<SviSliceQuotes<T>>& quotes,
+        const SviVolSurface* warmStart, unsigned threads) {
+        if (quotes.empty()) {
+            throw std::invalid_argument("No SVI slices to calibrate");
+        }
+
+        // Process slices in maturity order
+        std::vector<std::size_t> order(quotes.size());
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+        std::sort(order.begin(), order.end(),
+            [&quotes](std::size_t l, std::size_t r) { return quotes[l].maturity < quotes[r].maturity; });
+
+        const std::size_t n = quotes.size();
+        std::vector<SviParameters<T>> params(n);
+        // Slices are fitted independently; results land at fixed indices
+        parallelFor(n, threads, [&](std::size_t i) {
+            const auto& slice = quotes[order[i]];
+            if (warmStart) {
+                // Seed from the previous fit's closest maturity
+                const auto& mats = warmStart->maturities_;
+                auto it = std::lower_bound(mats.begin(), mats.end(), slice.maturity);
+                std::size_t j = static_cast<std::size_t>(it - mats.begin());
+                if (j == mats.size() || (j > 0 && slice.maturity - mats[j - 1] < mats[j] - slice.maturity)) {
+                    j = j - 1;
+                }
+                const SviParameters<T> guess = warmStart->slice(j);
+                params[i] = calibrateSlice(slice, &guess);
+            }
+            else {
+                params[i] = calibrateSlice(slice);
+            }
+        });
+
+        std::vector<T> maturities(n), forwards(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            maturities[i] = quotes[order[i]].maturity;
+            forwards[i] = quotes[order[i]].forward;
+        }
+        return SviVolSurface(std::move(maturities), std::move(forwards), std::move(params));
+    }
+
+    // ----- SsviVolSurface -----
+
+    template<typename T>
+    SsviVolSurface<T>::SsviVolSurface(std::vector<T> maturities, std::vector<T> forwards,
+        std::vector<T> atmTotalVariances, T rho, T eta, T gamma)
+        : maturities_(std::move(maturities)), thetas_(std::move(atmTotalVariances)),
+        rho_(rho), eta_(eta), gamma_(gamma) {
+        if (maturities_.empty() || maturities_.size() != forwards.size() ||
+            maturities_.size() != thetas_.size()) {
+            throw std::invalid_argument("SSVI surface needs matching, non-empty arrays");
+        }
+        if (std::abs(rho_) >= 1 || eta_ <= 0 || gamma_ <= 0 || gamma_ > T(0.5)) {
+            throw std::invalid_argument("Invalid SSVI parameters");
+        }
+        // Sufficient condition for no butterfly arbitrage with power-law phi
+        if (eta_ * (1 + std::abs(rho_)) > 2) {
+            throw std::invalid_argument("SSVI parameters admit butterfly arbitrage");
+        }
+
+        logForwards_.resize(forwards.size());
+        for (std::size_t i = 0; i < maturities_.size(); ++i) {
+            if (maturities_[i] <= 0 || (i > 0 && maturities_[i] <= maturities_[i - 1])) {
+                throw std::invalid_argument("SSVI maturities must be positive and increasing");
+            }
+            if (forwards[i] <= 0 || thetas_[i] <= 0) {
+                throw std::invalid_argument("SSVI forwards and ATM variances must be positive");
+            }
+            // Calendar arbitrage: ATM total variance must not decrease
+            if (i > 0 && thetas_[i] < thetas_[i - 1]) {
+                throw std::invalid_argument("SSVI ATM total variance decreases (calendar arbitrage)");
+            }
+            logForwards_[i] = std::log(forwards[i]);
+        }
+    }
+
+    template<typename T>
+    void SsviVolSurface<T>::interpolate(T maturity, T& theta, T& logForward) const {
+        const std::size_t last = maturities_.size() - 1;
+        if (maturity <= maturities_.front()) {
+            theta = thetas_.front() * maturity / maturities_.front();
+            logForward = logForwards_.front();
+            return;
+        }
+        if (maturity >= maturities_[last]) {
+            theta = thetas_[last] * maturity / maturities_[last];
+            logForward = logForwards_[last];
+            return;
+        }
+        const std::size_t hi = static_cast<std::size_t>(
+            std::upper_bound(maturities_.begin(), maturities_.end(), maturity) - maturities_.begin());
+        const T alpha = weight(maturity, maturities_[hi - 1], maturities_[hi]);
+        theta = (1 - alpha) * thetas_[hi - 1] + alpha * thetas_[hi];
+        logForward = (1 - alpha) * logForwards_[hi - 1] + alpha * logForwards_[hi];
+    }
+
+    template<typename T>
+    T SsviVolSurface<T>::variance(T k, T theta) const {
+        const T phi = eta_ / (std::pow(theta, gamma_) * std::pow(1 + theta, 1 - gamma_));
+        const T pk = phi * k;
+        return theta / 2 * (1 + rho_ * pk + std::sqrt((pk + rho_) * (pk + rho_) + 1 - rho_ * rho_));
+    }
+
+    template<typename T>
+    T SsviVolSurface<T>::totalVariance(T k, T maturity) const {
+        T theta, logForward;
+        interpolate(maturity, theta, logForward);
+        return variance(k, theta);
+    }
+
+    template<typename T>
+    T SsviVolSurface<T>::volatility(T strike, T maturity) const {
+        if (strike <= 0) {
+            throw std::invalid_argument("Strike must be positive");
+        }
+        const T t = maturity > 0 ? maturity : maturities_.front();
+        T theta, logForward;
+        interpolate(t, theta, logForward);
+        const T w = variance(std::log(strike) - logForward, theta);
+        return std::sqrt(std::max(w, T(0)) / t);
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template struct SviParameters<double>;
+    template struct SviParameters<float>;
+    template class SviVolSurface<double>;
+    template class SviVolSurface<float>;
+    template class SsviVolSurface<double>;
+    template class SsviVolSurface<float>;
+}
\ No newline at end of file
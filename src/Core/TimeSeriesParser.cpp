@@ -0,0 +1,217 @@
+// Same project headers.
+#include "Core/TimeSeriesParser.h"
+// 3rd party headers.
+#include <nlohmann/json.hpp>
+// std headers.
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <utility>
+
+namespace QuantEngine {
+    namespace {
+        using json = nlohmann::json;
+
+        // Top-level keys that carry a refusal instead of data
+        bool isRefusalKey(std::string_view key) {
+            return key == "Note" || key == "Information" || key == "Error Message" || key == "error_message";
+        }
+
+        // "YYYY-MM-DD" as YYYYMMDD, zero if the key is not a date
+        std::uint32_t parseDate(std::string_view key) {
+            if (key.size() < 10 || key[4] != '-' || key[7] != '-') {
+                return 0;
+            }
+            std::uint32_t y = 0, m = 0, d = 0;
+            const char* s = key.data();
+            if (std::from_chars(s, s + 4, y).ec != std::errc() || std::from_chars(s + 5, s + 7, m).ec != std::errc() ||
+                std::from_chars(s + 8, s + 10, d).ec != std::errc()) {
+                return 0;
+            }
+            return y * 10000 + m * 100 + d;
+        }
+
+        // What a handler extracts from each session
+        enum class Fields { None, Closes, Bars };
+
+        // One session's values in the order of the provider's "1. open" .. "5. volume" fields
+        struct Session {
+            std::uint32_t date = 0;
+            double values[5] = { 0, 0, 0, 0, 0 };
+        };
+        constexpr int CloseField = 3;
+        constexpr int VolumeField = 4;
+
+        // Field index of a session key, -1 for keys that are not extracted
+        int fieldIndex(std::string_view key, Fields fields) {
+            if (fields == Fields::Closes) {
+                return key == "4. close" ? CloseField : -1;
+            }
+            if (fields == Fields::Bars) {
+                constexpr std::string_view names[5] = { "1. open", "2. high", "3. low", "4. close", "5. volume" };
+                for (int i = 0; i < 5; ++i) {
+                    if (key == names[i]) return i;
+                }
+            }
+            return -1;
+        }
+
+        // SAX consumer tracking only the path it cares about:
+        // depth 1 top-level keys, depth 2 session dates, depth 3 the extracted fields
+        class DailyHandler {
+        public:
+            DailyHandler(TimeSeriesParser::DailySeries& out, std::vector<Session>& sessions, Fields fields)
+                : out_(out), sessions_(sessions), fields_(fields) {}
+
+            bool start_object(std::size_t) {
+                ++depth_;
+                if (depth_ == 2 && inSeriesKey_) {
+                    inSeries_ = true;
+                    out_.hasSeries = true;
+                }
+                return true;
+            }
+
+            bool end_object() {
+                if (depth_ == 2) {
+                    inSeries_ = false;
+                }
+                --depth_;
+                return true;
+            }
+
+            bool key(json::string_t& key) {
+                expectValue_ = false;
+                expectRefusal_ = false;
+                if (depth_ == 1) {
+                    inSeriesKey_ = key == "Time Series (Daily)";
+                    if (isRefusalKey(key) && out_.refusalKey.empty()) {
+                        out_.refusalKey = key;
+                        expectRefusal_ = true;
+                    }
+                }
+                else if (depth_ == 2 && inSeries_) {
+                    if (fields_ != Fields::None) {
+                        sessions_.push_back(Session{ parseDate(key) });
+                    }
+                }
+                else if (depth_ == 3 && inSeries_) {
+                    field_ = fieldIndex(key, fields_);
+                    expectValue_ = field_ >= 0;
+                }
+                return true;
+            }
+
+            bool string(json::string_t& value) {
+                if (expectValue_) {
+                    double number = 0.0;
+                    const auto res = std::from_chars(value.data(), value.data() + value.size(), number);
+                    const bool valid = field_ == VolumeField ? number >= 0 : number > 0;
+                    if (res.ec != std::errc() || !valid) {
+                        throw std::runtime_error(std::string(field_ == CloseField ? "Invalid close price" :
+                            "Invalid daily bar value") + " in Alpha Vantage response: " + value);
+                    }
+                    sessions_.back().values[field_] = number;
+                }
+                else if (expectRefusal_) {
+                    out_.refusal = std::move(value);
+                }
+                expectValue_ = expectRefusal_ = false;
+                return true;
+            }
+
+            // Scalars and arrays are skipped
+            bool null() { return reset(); }
+            bool boolean(bool) { return reset(); }
+            bool number_integer(json::number_integer_t) { return reset(); }
+            bool number_unsigned(json::number_unsigned_t) { return reset(); }
+            bool number_float(json::number_float_t, const json::string_t&) { return reset(); }
+            bool binary(json::binary_t&) { return reset(); }
+            bool start_array(std::size_t) { ++depth_; return reset(); }
+            bool end_array() { --depth_; return true; }
+
+            bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& e) {
+                throw std::runtime_error("Malformed Alpha Vantage response at byte " + std::to_string(position) +
+                    ": " + e.what());
+            }
+
+        private:
+            bool reset() {
+                expectValue_ = expectRefusal_ = false;
+                return true;
+            }
+
+            TimeSeriesParser::DailySeries& out_;
+            std::vector<Session>& sessions_;
+            Fields fields_;
+            int depth_ = 0;
+            int field_ = -1;
+            bool inSeriesKey_ = false, inSeries_ = false;
+            bool expectValue_ = false, expectRefusal_ = false;
+        };
+
+        // Shared body of parseDaily and parseDailyBars
+        TimeSeriesParser::DailySeries parse(std::string_view body, std::size_t maxDays, Fields fields) {
+            TimeSeriesParser::DailySeries series;
+
+            // One session entry takes ~150 bytes of JSON, so this avoids regrowth for full histories
+            std::vector<Session> sessions;
+            sessions.reserve(body.size() / 150 + 1);
+
+            DailyHandler handler(series, sessions, fields);
+            json::sax_parse(body.begin(), body.end(), &handler);
+
+            // Sessions without a close are not sessions
+            sessions.erase(std::remove_if(sessions.begin(), sessions.end(),
+                [](const Session& s) { return s.values[CloseField] == 0; }), sessions.end());
+
+            // Provider lists newest first; anything else gets sorted
+            const auto byDate = [](const Session& a, const Session& b) { return a.date < b.date; };
+            if (!std::is_sorted(sessions.begin(), sessions.end(), byDate)) {
+                std::reverse(sessions.begin(), sessions.end());
+                if (!std::is_sorted(sessions.begin(), sessions.end(), byDate)) {
+                    std::stable_sort(sessions.begin(), sessions.end(), byDate);
+                }
+            }
+
+            // Keep the most recent maxDays, oldest first
+            const std::size_t keep = std::min(maxDays, sessions.size());
+            const bool bars = fields == Fields::Bars;
+            series.closes.reserve(keep);
+            series.dates.reserve(keep);
+            for (std::size_t i = sessions.size() - keep; i < sessions.size(); ++i) {
+                const Session& session = sessions[i];
+                series.dates.push_back(session.date);
+                series.closes.push_back(session.values[CloseField]);
+                if (bars) {
+                    series.opens.push_back(session.values[0]);
+                    series.highs.push_back(session.values[1]);
+                    series.lows.push_back(session.values[2]);
+                    series.volumes.push_back(session.values[VolumeField]);
+                }
+            }
+            return series;
+        }
+    }
+
+    TimeSeriesParser::DailySeries TimeSeriesParser::parseDaily(std::string_view body, std::size_t maxDays) {
+        return parse(body, maxDays, Fields::Closes);
+    }
+
+    TimeSeriesParser::DailySeries TimeSeriesParser::parseDailyBars(std::string_view body, std::size_t maxDays) {
+        return parse(body, maxDays, Fields::Bars);
+    }
+
+    bool TimeSeriesParser::refused(std::string_view body) {
+        DailySeries series;
+        std::vector<Session> unused;
+        DailyHandler handler(series, unused, Fields::None);
+        try {
+            json::sax_parse(body.begin(), body.end(), &handler);
+        }
+        catch (const std::exception&) {
+            return true;
+        }
+        return series.refused();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,359 @@
+// Same project headers.
+#include "Core/YieldCurve.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+namespace QuantEngine {
+    namespace {
+        // Cache slot for a maturity: its bit pattern mixed by a multiplicative hash
+        template<typename T>
+        std::size_t cacheSlot(T time, std::size_t slots) {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &time, sizeof(T));
+            return static_cast<std::size_t>((bits * 0x9E3779B97F4A7C15ull) >> 32) % slots;
+        }
+    }
+
+    template<typename T>
+    YieldCurve<T>::YieldCurve(std::vector<T> times, std::vector<T> rates, Interpolation method)
+        : method_(method) {
+        discountCache_.fill({ std::numeric_limits<T>::quiet_NaN(), T(0) });
+
+        // Validate raw curve inputs
+        if (times.empty() || times.size() != rates.size()) {
+            throw std::invalid_argument("Yield curve needs matching, non-empty time and rate arrays");
+        }
+
+        // Sort nodes by time once, keeping rates paired with their times
+        std::vector<std::size_t> order(times.size());
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+        std::sort(order.begin(), order.end(),
+            [&times](std::size_t a, std::size_t b) { return times[a] < times[b]; });
+
+        times_.reserve(times.size());
+        rates_.reserve(rates.size());
+        for (std::size_t idx : order) {
+            if (times[idx] < 0 || rates[idx] < 0) {
+                throw std::invalid_argument("Invalid time/rate");
+            }
+            if (!times_.empty() && times[idx] - times_.back() <= std::numeric_limits<T>::epsilon()) {
+                throw std::invalid_argument("Duplicate yield curve node time");
+            }
+            times_.push_back(times[idx]);
+            rates_.push_back(rates[idx]);
+        }
+
+        // Precompute segment coefficients for the chosen scheme
+        switch (method_) {
+        case Interpolation::Linear:
+            buildLinear();
+            break;
+        case Interpolation::CubicSpline:
+            buildCubicSpline();
+            break;
+        case Interpolation::MonotoneConvex:
+            buildMonotoneConvex();
+            break;
+        default:
+            throw std::invalid_argument("Unknown yield curve interpolation");
+        }
+    }
+
+    template<typename T>
+    void YieldCurve<T>::buildLinear() {
+        knots_ = times_;
+        const std::size_t segments = knots_.size() - 1;
+        c0_.assign(segments, T(0));
+        c1_.assign(segments, T(0));
+        c2_.assign(segments, T(0));
+        c3_.assign(segments, T(0));
+
+        // Straight line between neighbouring zero rates
+        for (std::size_t i = 0; i < segments; ++i) {
+            c0_[i] = rates_[i];
+            c1_[i] = (rates_[i + 1] - rates_[i]) / (knots_[i + 1] - knots_[i]);
+        }
+    }
+
+    template<typename T>
+    void YieldCurve<T>::buildCubicSpline() {
+        knots_ = times_;
+        const std::size_t n = knots_.size();
+        if (n < 3) {
+            // Two points leave no curvature to fit
+            buildLinear();
+            return;
+        }
+
+        // Solve the tridiagonal system for natural-spline second derivatives (Thomas algorithm)
+        std::vector<T> h(n - 1), m(n, T(0)), diag(n, T(0)), rhs(n, T(0));
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            h[i] = knots_[i + 1] - knots_[i];
+        }
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            diag[i] = 2 * (h[i - 1] + h[i]);
+            rhs[i] = 6 * ((rates_[i + 1] - rates_[i]) / h[i] - (rates_[i] - rates_[i - 1]) / h[i - 1]);
+        }
+        for (std::size_t i = 2; i + 1 < n; ++i) {
+            const T w = h[i - 1] / diag[i - 1];
+            diag[i] -= w * h[i - 1];
+            rhs[i] -= w * rhs[i - 1];
+        }
+        for (std::size_t i = n - 2; i >= 1; --i) {
+            m[i] = (rhs[i] - h[i] * m[i + 1]) / diag[i];
+        }
+
+        // Convert second derivatives into per-segment polynomial coefficients
+        c0_.resize(n - 1);
+        c1_.resize(n - 1);
+        c2_.resize(n - 1);
+        c3_.resize(n - 1);
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            c0_[i] = rates_[i];
+            c1_[i] = (rates_[i + 1] - rates_[i]) / h[i] - h[i] * (2 * m[i] + m[i + 1]) / 6;
+            c2_[i] = m[i] / 2;
+            c3_[i] = (m[i + 1] - m[i]) / (6 * h[i]);
+        }
+    }
+
+    template<typename T>
+    void YieldCurve<T>::buildMonotoneConvex() {
+        // Hagan-West works on r*t from an anchor at t = 0
+        knots_.clear();
+        std::vector<T> y;
+        if (times_.front() > 0) {
+            knots_.push_back(T(0));
+            y.push_back(T(0));
+        }
+        for (std::size_t i = 0; i < times_.size(); ++i) {
+            knots_.push_back(times_[i]);
+            y.push_back(rates_[i] * times_[i]);
+        }
+
+        const std::size_t segments = knots_.size() - 1;
+        c0_.assign(segments, T(0));
+        c1_.assign(segments, T(0));
+        c2_.assign(segments, T(0));
+        c3_.assign(segments, T(0));
+        c4_.assign(segments, T(0));
+        sector_.assign(segments, 0);
+        if (segments == 0) {
+            return;
+        }
+
+        // Discrete forwards over each segment
+        std::vector<T> fd(segments);
+        for (std::size_t s = 0; s < segments; ++s) {
+            fd[s] = (y[s + 1] - y[s]) / (knots_[s + 1] - knots_[s]);
+        }
+
+        // Instantaneous forwards at the knots
+        std::vector<T> f(segments + 1);
+        for (std::size_t j = 1; j < segments; ++j) {
+            const T span = knots_[j + 1] - knots_[j - 1];
+            f[j] = (knots_[j] - knots_[j - 1]) / span * fd[j]
+                + (knots_[j + 1] - knots_[j]) / span * fd[j - 1];
+        }
+        if (segments == 1) {
+            f[0] = f[1] = fd[0];
+        }
+        else {
+            f[0] = fd[0] - T(0.5) * (f[1] - fd[0]);
+            f[segments] = fd[segments - 1] - T(0.5) * (f[segments - 1] - fd[segments - 1]);
+        }
+
+        // Classify each segment into its Hagan-West sector and precompute eta
+        for (std::size_t s = 0; s < segments; ++s) {
+            const T g0 = f[s] - fd[s];
+            const T g1 = f[s + 1] - fd[s];
+            c0_[s] = y[s];
+            c1_[s] = fd[s];
+            c2_[s] = g0;
+            c3_[s] = g1;
+
+            if ((g0 < 0 && -T(0.5) * g0 <= g1 && g1 <= -2 * g0) ||
+                (g0 > 0 && -T(0.5) * g0 >= g1 && g1 >= -2 * g0)) {
+                sector_[s] = 1;
+            }
+            else if ((g0 < 0 && g1 > -2 * g0) || (g0 > 0 && g1 < -2 * g0)) {
+                sector_[s] = 2;
+                c4_[s] = (g1 + 2 * g0) / (g1 - g0);
+            }
+            else if ((g0 > 0 && 0 > g1 && g1 > -T(0.5) * g0) ||
+                (g0 < 0 && 0 < g1 && g1 < -T(0.5) * g0)) {
+                sector_[s] = 3;
+                c4_[s] = 3 * g1 / (g1 - g0);
+            }
+            else if (g0 == 0 && g1 == 0) {
+                sector_[s] = 0;
+            }
+            else {
+                sector_[s] = 4;
+                c4_[s] = g1 / (g1 + g0);
+            }
+        }
+    }
+
+    template<typename T>
+    std::size_t YieldCurve<T>::findSegment(T time, std::size_t hint) const {
+        // Restart from the front if the hint is already past the requested time
+        if (hint >= knots_.size() || knots_[hint] > time) {
+            hint = 0;
+        }
+        auto it = std::upper_bound(knots_.begin() + hint, knots_.end(), time);
+        std::size_t s = static_cast<std::size_t>(it - knots_.begin());
+        s = (s == 0) ? 0 : s - 1;
+        return std::min(s, knots_.size() - 2);
+    }
+
+    template<typename T>
+    T YieldCurve<T>::integratedRate(T time, std::size_t s) const {
+        const T dx = time - knots_[s];
+
+        if (method_ != Interpolation::MonotoneConvex) {
+            // Horner evaluation of the zero-rate polynomial
+            const T r = c0_[s] + dx * (c1_[s] + dx * (c2_[s] + dx * c3_[s]));
+            return r * time;
+        }
+
+        // Monotone convex: r*t = y_left + fd*dx + h*G(x)
+        const T h = knots_[s + 1] - knots_[s];
+        const T x = dx / h;
+        const T g0 = c2_[s], g1 = c3_[s], eta = c4_[s];
+        T G{ 0 };
+
+        if (x > 0) {
+            switch (sector_[s]) {
+            case 1:
+                G = g0 * (x - 2 * x * x + x * x * x) + g1 * (-x * x + x * x * x);
+                break;
+            case 2:
+                G = g0 * x;
+                if (x > eta) {
+                    const T u = x - eta;
+                    G += (g1 - g0) * u * u * u / ((1 - eta) * (1 - eta)) / 3;
+                }
+                break;
+            case 3:
+                if (x < eta) {
+                    const T u = eta - x;
+                    G = g1 * x - (g0 - g1) / 3 * (u * u * u / (eta * eta) - eta);
+                }
+                else {
+                    G = g1 * x + (g0 - g1) / 3 * eta;
+                }
+                break;
+            case 4: {
+                const T A = -g0 * g1 / (g0 + g1);
+                if (x <= eta) {
+                    const T u = eta - x;
+                    G = A * x - (g0 - A) / 3 * (u * u * u / (eta * eta) - eta);
+                }
+                else {
+                    const T u = x - eta;
+                    G = A * x + (g0 - A) / 3 * eta + (g1 - A) / 3 * u * u * u / ((1 - eta) * (1 - eta));
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        return c0_[s] + c1_[s] * dx + h * G;
+    }
+
+    template<typename T>
+    T YieldCurve<T>::zeroRate(T time) const {
+        // Flat curve and flat extrapolation beyond the last quote
+        if (times_.size() == 1 || time >= times_.back()) {
+            return rates_.back();
+        }
+
+        if (method_ == Interpolation::MonotoneConvex) {
+            // Short end tends to the instantaneous forward at t = 0
+            if (time <= 0) {
+                return c1_[0] + c2_[0];
+            }
+            return integratedRate(time, findSegment(time)) / time;
+        }
+
+        // Flat extrapolation before the first quote
+        if (time <= times_.front()) {
+            return rates_.front();
+        }
+        const std::size_t s = findSegment(time);
+        const T dx = time - knots_[s];
+        return c0_[s] + dx * (c1_[s] + dx * (c2_[s] + dx * c3_[s]));
+    }
+
+    template<typename T>
+    T YieldCurve<T>::discountFactor(T time) const {
+        if (time <= 0) {
+            return T(1);
+        }
+        if (method_ == Interpolation::MonotoneConvex && times_.size() > 1 && time < times_.back()) {
+            return std::exp(-integratedRate(time, findSegment(time)));
+        }
+        return std::exp(-zeroRate(time) * time);
+    }
+
+    template<typename T>
+    void YieldCurve<T>::discountFactors(std::span<const T> times, std::span<T> out) const {
+        if (out.size() < times.size()) {
+            throw std::invalid_argument("Output span too small for discount factors");
+        }
+
+        // Sorted inputs reuse the previous segment as the search starting point
+        const bool interior = times_.size() > 1;
+        std::size_t hint = 0;
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            const T t = times[i];
+            if (t <= 0) {
+                out[i] = T(1);
+            }
+            else if (!interior || t >= times_.back()) {
+                out[i] = std::exp(-rates_.back() * t);
+            }
+            else if (method_ != Interpolation::MonotoneConvex && t <= times_.front()) {
+                out[i] = std::exp(-rates_.front() * t);
+            }
+            else {
+                hint = findSegment(t, hint);
+                out[i] = std::exp(-integratedRate(t, hint));
+            }
+        }
+    }
+
+    template<typename T>
+    T YieldCurve<T>::cachedDiscountFactor(T time) const {
+        CacheSlot& slot = discountCache_[cacheSlot(time, DiscountCacheSlots)];
+
+        // Fast path: readers share the lock
+        {
+            std::shared_lock lock(cacheMutex_);
+            if (slot.time == time) {
+                return slot.discountFactor;
+            }
+        }
+
+        // Slow path: compute outside the lock, then take over the slot
+        const T df = discountFactor(time);
+        std::unique_lock lock(cacheMutex_);
+        slot = { time, df };
+        return df;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class YieldCurve<double>;
+    template class YieldCurve<float>;
+}
\ No newline at end of file
@@ -14,36 +14,74 @@ namespace QuantEngine {
         validate();
     }
 
+    template<typename T>
+    EuropeanStockOption<T>::EuropeanStockOption(const typename Instrument<T>::Parameters& params,
+        std::pmr::memory_resource* resource)
+        : params_(params), marketData_(resource) {
+        validate();
+    }
+
+    template<typename T>
+    EuropeanStockOption<T>::~EuropeanStockOption() {
+        if (observingEngine_) {
+            pricingEngine_->unregisterObserver(this);
+        }
+    }
+
     template<typename T>
     T EuropeanStockOption<T>::price() const {
         // Ensure pricing method is configured before calculation
         if (!pricingEngine_) {
             throw std::runtime_error("Pricing engine not set");
         }
-        // Calculate base price and apply contract multiplier
-        return pricingEngine_->calculatePrice(*this, marketData_) * params_.notional_;
+        // Repeat calls on an unchanged option return the stored value
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!price_) {
+            // Calculate base price and apply contract multiplier
+            price_ = pricingEngine_->calculatePrice(*this, marketData_) * params_.notional_;
+        }
+        return *price_;
     }
 
     template<typename T>
-    std::map<std::string, T> EuropeanStockOption<T>::greeks() const {
+    Greeks<T> EuropeanStockOption<T>::greeks() const {
         // Require pricing engine with Greek calculation support
         if (!pricingEngine_) {
             throw std::runtime_error("Pricing engine not set for European stock option");
         }
-        // Delegate risk calculation to pricing engine
-        return pricingEngine_->calculateGreeks(*this, marketData_);
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!greeks_) {
+            // Delegate risk calculation to pricing engine
+            greeks_ = pricingEngine_->calculateGreeks(*this, marketData_);
+        }
+        return *greeks_;
     }
 
     template<typename T>
     void EuropeanStockOption<T>::updateMarketData(const MarketData<T>& market) {
         // Refresh current market conditions (rates, volatilities)
         marketData_ = market;
+        invalidate();
     }
 
     template<typename T>
     void EuropeanStockOption<T>::setPricingEngine(std::shared_ptr<PricingEngine<T>> engine) {
+        setPricingEngine(std::move(engine), true);
+    }
+
+    template<typename T>
+    void EuropeanStockOption<T>::setPricingEngine(std::shared_ptr<PricingEngine<T>> engine, bool observeEngine) {
         // Set calculation strategy (Monte Carlo, Analytic, etc.)
-        pricingEngine_ = engine;
+        // and follow its changes instead of the old engine's
+        if (observingEngine_) {
+            pricingEngine_->unregisterObserver(this);
+        }
+        pricingEngine_ = std::move(engine);
+        observingEngine_ = observeEngine && pricingEngine_;
+        if (observingEngine_) {
+            pricingEngine_->registerObserver(this);
+        }
+        invalidate();
     }
 
     template<typename T>
@@ -61,6 +99,36 @@ namespace QuantEngine {
         return params_;
     }
 
+    template<typename T>
+    void EuropeanStockOption<T>::setParameters(const typename Instrument<T>::Parameters& params) {
+        // Check the new terms before replacing the current ones
+        const typename Instrument<T>::Parameters previous = params_;
+        params_ = params;
+        try {
+            validate();
+        }
+        catch (...) {
+            params_ = previous;
+            throw;
+        }
+        invalidate();
+    }
+
+    template<typename T>
+    void EuropeanStockOption<T>::update() {
+        invalidate();
+    }
+
+    template<typename T>
+    void EuropeanStockOption<T>::invalidate() {
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex_);
+            price_.reset();
+            greeks_.reset();
+        }
+        this->notifyObservers();
+    }
+
     // Generate concrete template implementations to prevent linker errors
     template class EuropeanStockOption<double>;
     template class EuropeanStockOption<float>;
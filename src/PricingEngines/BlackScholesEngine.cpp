@@ -1,9 +1,11 @@
 // Same project headers.
 #include "PricingEngines/BlackScholesEngine.h"
+#include "Core/Portfolio.h"
 // 3rd party headers.
 // ....
 // std headers.
 #include <cmath>
+#include <stdexcept>
 
 namespace QuantEngine {
     template<typename T>
@@ -17,6 +19,7 @@ namespace QuantEngine {
         // Retrieve market conditions for pricing
         T r = marketData.getRiskFreeRate(maturity);    // Risk-free rate
         T sigma = marketData.getVolatility(K, maturity); // Volatility
+        T df = marketData.getDiscountFactor(maturity);  // e^(-rT), cached when a curve is attached
 
         // Calculate Black-Scholes intermediate terms
         T d1 = this->d1(S, K, r, sigma, maturity);
@@ -25,11 +28,42 @@ namespace QuantEngine {
         // Compute call/put price using Black-Scholes formula
         if (params.isCall_) {
             // Call formula: S*N(d1) - K*e^(-rT)*N(d2)
-            return S * N(d1) - K * std::exp(-r * maturity) * N(d2);
+            return S * N(d1) - K * df * N(d2);
         }
         else {
             // Put formula: K*e^(-rT)*N(-d2) - S*N(-d1)
-            return K * std::exp(-r * maturity) * N(-d2) - S * N(-d1);
+            return K * df * N(-d2) - S * N(-d1);
+        }
+    }
+
+    template<typename T>
+    void BlackScholesEngine<T>::calculatePrices(const Portfolio<T>& portfolio, std::span<T> out) const {
+        if (out.size() != portfolio.size()) {
+            throw std::invalid_argument("Output size does not match portfolio size");
+        }
+
+        // Column views; each row reads only the fields it needs
+        const auto notionals = portfolio.notionals();
+        const auto strikes = portfolio.strikes();
+        const auto maturities = portfolio.maturities();
+        const auto spots = portfolio.spots();
+        const auto isCall = portfolio.isCall();
+        const auto underlyings = portfolio.underlyings();
+
+        for (std::size_t i = 0; i < portfolio.size(); ++i) {
+            const MarketData<T>& market = portfolio.market(underlyings[i]);
+            const T S = spots[i];
+            const T K = strikes[i];
+            const T maturity = maturities[i];
+
+            // Same formula as calculatePrice, scaled by the trade notional
+            const T r = market.getRiskFreeRate(maturity);
+            const T sigma = market.getVolatility(K, maturity);
+            const T df = market.getDiscountFactor(maturity);
+            const T d1 = this->d1(S, K, r, sigma, maturity);
+            const T d2 = d1 - sigma * std::sqrt(maturity);
+            const T unit = isCall[i] ? S * N(d1) - K * df * N(d2) : K * df * N(-d2) - S * N(-d1);
+            out[i] = notionals[i] * unit;
         }
     }
 
@@ -42,16 +76,16 @@ namespace QuantEngine {
     // Black-Scholes d1 calculation
     // Represents (ln(S/K) + (r + sigma^2/2)T) / (sigma*sqrt(T))
     template<typename T>
-    T BlackScholesEngine<T>::d1(T S, T K, T r, T sigma, T T) const {
-        return (std::log(S / K) + (r + 0.5 * sigma * sigma) * T)
-            / (sigma * std::sqrt(T));
+    T BlackScholesEngine<T>::d1(T S, T K, T r, T sigma, T t) const {
+        return (std::log(S / K) + (r + 0.5 * sigma * sigma) * t)
+            / (sigma * std::sqrt(t));
     }
 
     // Black-Scholes d2 calculation
     // Simplified as d1 - sigma*sqrt(T)
     template<typename T>
-    T BlackScholesEngine<T>::d2(T S, T K, T r, T sigma, T T) const {
-        return d1(S, K, r, sigma, T) - sigma * std::sqrt(T);
+    T BlackScholesEngine<T>::d2(T S, T K, T r, T sigma, T t) const {
+        return d1(S, K, r, sigma, t) - sigma * std::sqrt(t);
     }
 
     // Normal cumulative distribution function (CDF)
@@ -71,7 +105,7 @@ namespace QuantEngine {
 
     // Risk sensitivity calculations (Greeks)
     template<typename T>
-    std::map<std::string, T> BlackScholesEngine<T>::calculateGreeks(
+    Greeks<T> BlackScholesEngine<T>::calculateGreeks(
         const Instrument<T>& instrument, const MarketData<T>& marketData) const {
         const auto& params = instrument.getParameters();
         const T S = params.spotPrice_;
@@ -86,19 +120,19 @@ namespace QuantEngine {
         // Pre-calculate common values
         const T d1_val = d1(S, K, r, sigma, maturity);
         const T d2_val = d2(S, K, r, sigma, maturity);
-        const T discountFactor = std::exp(-r * maturity);
+        const T discountFactor = marketData.getDiscountFactor(maturity);
         const T n_prime = N_prime(d1_val);
 
-        std::map<std::string, T> greeks;
+        Greeks<T> greeks;
 
         // Delta: Price sensitivity to underlying price
-        greeks["delta"] = isCall ? N(d1_val) : N(d1_val) - T(1);
+        greeks[Greek::Delta] = isCall ? N(d1_val) : N(d1_val) - T(1);
 
         // Gamma: Delta's sensitivity to underlying price
-        greeks["gamma"] = n_prime / (S * sigma * std::sqrt(maturity));
+        greeks[Greek::Gamma] = n_prime / (S * sigma * std::sqrt(maturity));
 
         // Vega: Price sensitivity to volatility (per 1% change)
-        greeks["vega"] = S * std::sqrt(maturity) * n_prime * T(0.01);
+        greeks[Greek::Vega] = S * std::sqrt(maturity) * n_prime * T(0.01);
 
         // Theta: Price sensitivity to time (daily decay)
         T theta;
@@ -110,14 +144,14 @@ namespace QuantEngine {
             theta = (-(S * sigma * n_prime) / (2 * std::sqrt(maturity))
                 + r * K * discountFactor * N(-d2_val)) / T(365);
         }
-        greeks["theta"] = theta;
+        greeks[Greek::Theta] = theta;
 
         // Rho: Price sensitivity to interest rates (per 1% change)
         if (isCall) {
-            greeks["rho"] = K * maturity * discountFactor * N(d2_val) * T(0.01);
+            greeks[Greek::Rho] = K * maturity * discountFactor * N(d2_val) * T(0.01);
         }
         else {
-            greeks["rho"] = -K * maturity * discountFactor * N(-d2_val) * T(0.01);
+            greeks[Greek::Rho] = -K * maturity * discountFactor * N(-d2_val) * T(0.01);
         }
 
         return greeks;
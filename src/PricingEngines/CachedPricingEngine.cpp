@@ -0,0 +1,169 @@
+// Same project headers.
+#include "PricingEngines/CachedPricingEngine.h"
+#include "Core/Portfolio.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <stdexcept>
+
+namespace QuantEngine {
+    template<typename T>
+    CachedPricingEngine<T>::CachedPricingEngine(std::shared_ptr<const PricingEngine<T>> inner,
+        std::size_t capacity, std::size_t shards)
+        : inner_(std::move(inner)), capacity_(capacity), shardCount_(shards) {
+        if (!inner_) {
+            throw std::invalid_argument("Cached engine needs an inner engine");
+        }
+        if (capacity_ == 0 || shardCount_ == 0) {
+            throw std::invalid_argument("Cache capacity and shard count must be positive");
+        }
+
+        // Every shard holds at least one entry, and the shares add up to exactly capacity
+        shardCount_ = std::min(shardCount_, capacity_);
+        shards_ = std::make_unique<Shard[]>(shardCount_);
+        for (std::size_t s = 0; s < shardCount_; ++s) {
+            shards_[s].capacity = capacity_ / shardCount_ + (s < capacity_ % shardCount_ ? 1 : 0);
+        }
+    }
+
+    template<typename T>
+    std::size_t CachedPricingEngine<T>::KeyHash::operator()(const Key& key) const {
+        // Boost-style combine over the exact bit patterns of each field
+        std::size_t h = std::hash<std::uint64_t>{}(key.version);
+        auto mix = [&h](std::size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+        mix(std::hash<T>{}(key.strike));
+        mix(std::hash<T>{}(key.maturity));
+        mix(std::hash<T>{}(key.spot));
+        mix(key.isCall ? 1 : 0);
+        return h;
+    }
+
+    template<typename T>
+    typename CachedPricingEngine<T>::Key CachedPricingEngine<T>::makeKey(
+        const typename Instrument<T>::Parameters& params, const MarketData<T>& marketData) {
+        return { params.strike_, params.maturity_, params.spotPrice_, params.isCall_, marketData.version() };
+    }
+
+    template<typename T>
+    typename CachedPricingEngine<T>::Shard& CachedPricingEngine<T>::shardFor(std::size_t hash) const {
+        // High bits pick the shard so the shard's own hash table still sees well-spread low bits
+        return shards_[std::rotl(hash, 17) % shardCount_];
+    }
+
+    template<typename T>
+    typename CachedPricingEngine<T>::Entry& CachedPricingEngine<T>::touch(Shard& shard, const Key& key) const {
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            // Move to the front without reallocating the node
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            return *it->second;
+        }
+
+        shard.lru.push_front(Entry{ key, std::nullopt, std::nullopt });
+        shard.index.emplace(key, shard.lru.begin());
+
+        // Evict least recently used entries beyond this shard's share
+        while (shard.lru.size() > shard.capacity) {
+            shard.index.erase(shard.lru.back().key);
+            shard.lru.pop_back();
+        }
+        return shard.lru.front();
+    }
+
+    template<typename T>
+    T CachedPricingEngine<T>::calculatePrice(const Instrument<T>& instrument,
+        const MarketData<T>& marketData) const {
+        const Key key = makeKey(instrument.getParameters(), marketData);
+        const std::size_t hash = KeyHash{}(key);
+        Shard& shard = shardFor(hash);
+
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end() && it->second->price) {
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return *it->second->price;
+            }
+        }
+
+        // Price outside the lock; a concurrent miss on the same key stores the same value
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        const T price = inner_->calculatePrice(instrument, marketData);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        touch(shard, key).price = price;
+        return price;
+    }
+
+    template<typename T>
+    Greeks<T> CachedPricingEngine<T>::calculateGreeks(const Instrument<T>& instrument,
+        const MarketData<T>& marketData) const {
+        const Key key = makeKey(instrument.getParameters(), marketData);
+        const std::size_t hash = KeyHash{}(key);
+        Shard& shard = shardFor(hash);
+
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end() && it->second->greeks) {
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return *it->second->greeks;
+            }
+        }
+
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        auto greeks = inner_->calculateGreeks(instrument, marketData);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        touch(shard, key).greeks = greeks;
+        return greeks;
+    }
+
+    template<typename T>
+    void CachedPricingEngine<T>::calculatePrices(const Portfolio<T>& portfolio, std::span<T> out) const {
+        if (out.size() != portfolio.size()) {
+            throw std::invalid_argument("Output size does not match portfolio size");
+        }
+
+        const auto notionals = portfolio.notionals();
+        const auto underlyings = portfolio.underlyings();
+        for (std::size_t i = 0; i < portfolio.size(); ++i) {
+            const PortfolioRow<T> row(portfolio, i);
+            out[i] = notionals[i] * calculatePrice(row, portfolio.market(underlyings[i]));
+        }
+    }
+
+    template<typename T>
+    std::unique_ptr<PricingEngine<T>> CachedPricingEngine<T>::clone() const {
+        return std::make_unique<CachedPricingEngine<T>>(
+            std::shared_ptr<const PricingEngine<T>>(inner_->clone()), capacity_, shardCount_);
+    }
+
+    template<typename T>
+    void CachedPricingEngine<T>::clear() {
+        for (std::size_t s = 0; s < shardCount_; ++s) {
+            std::lock_guard<std::mutex> lock(shards_[s].mutex);
+            shards_[s].index.clear();
+            shards_[s].lru.clear();
+        }
+    }
+
+    template<typename T>
+    std::size_t CachedPricingEngine<T>::size() const {
+        std::size_t total = 0;
+        for (std::size_t s = 0; s < shardCount_; ++s) {
+            std::lock_guard<std::mutex> lock(shards_[s].mutex);
+            total += shards_[s].lru.size();
+        }
+        return total;
+    }
+
+    // Generate template implementations for common numeric types
+    template class CachedPricingEngine<double>;
+    template class CachedPricingEngine<float>;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Same project headers.
+#include "Risk/CovarianceMatrix.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace QuantEngine {
+    template<typename T>
+    CovarianceMatrix<T>::CovarianceMatrix(std::size_t dimension)
+        : dimension_(dimension), stride_((dimension * sizeof(T) + 63) / 64 * 64 / sizeof(T)),
+        values_(dimension * stride_, T(0)) {
+    }
+
+    template<typename T>
+    CovarianceMatrix<T> CovarianceMatrix<T>::fromReturns(std::span<const T> returns, std::size_t days, std::size_t factors) {
+        if (returns.size() != days * factors) {
+            throw std::invalid_argument("Return matrix size does not match days x factors");
+        }
+        if (days < 2) {
+            throw std::invalid_argument("Covariance needs at least two observations");
+        }
+
+        // Column means
+        std::vector<T> mean(factors, T(0));
+        for (std::size_t d = 0; d < days; ++d) {
+            const T* row = returns.data() + d * factors;
+            for (std::size_t a = 0; a < factors; ++a) {
+                mean[a] += row[a];
+            }
+        }
+        for (T& m : mean) {
+            m /= static_cast<T>(days);
+        }
+
+        CovarianceMatrix result(factors);
+        std::vector<T> block(DayBlock * factors);
+        for (std::size_t start = 0; start < days; start += DayBlock) {
+            const std::size_t count = std::min(DayBlock, days - start);
+
+            // Centre one block of days
+            for (std::size_t d = 0; d < count; ++d) {
+                const T* in = returns.data() + (start + d) * factors;
+                T* out = block.data() + d * factors;
+                for (std::size_t a = 0; a < factors; ++a) {
+                    out[a] = in[a] - mean[a];
+                }
+            }
+
+            // Upper triangle: each (day, a) pair is a contiguous axpy over b >= a
+            for (std::size_t a = 0; a < factors; ++a) {
+                T* target = &result(a, 0);
+                for (std::size_t d = 0; d < count; ++d) {
+                    const T* row = block.data() + d * factors;
+                    const T xa = row[a];
+                    for (std::size_t b = a; b < factors; ++b) {
+                        target[b] += xa * row[b];
+                    }
+                }
+            }
+        }
+
+        // Scale and mirror
+        const T scale = T(1) / static_cast<T>(days - 1);
+        for (std::size_t a = 0; a < factors; ++a) {
+            for (std::size_t b = a; b < factors; ++b) {
+                result(a, b) *= scale;
+                result(b, a) = result(a, b);
+            }
+        }
+        return result;
+    }
+
+    template<typename T>
+    CovarianceMatrix<T> CovarianceMatrix<T>::fromCloses(const std::vector<std::vector<T>>& closes,
+        const std::vector<std::vector<T>>& vols) {
+        if (closes.empty() || closes.front().size() < 3) {
+            throw std::invalid_argument("Covariance needs at least three closes per underlying");
+        }
+        const std::size_t observations = closes.front().size();
+        if (!vols.empty() && vols.size() != closes.size()) {
+            throw std::invalid_argument("Vol histories must match the close histories");
+        }
+        for (const auto& series : closes) {
+            if (series.size() != observations) throw std::invalid_argument("Historical series must cover the same dates");
+        }
+        for (const auto& series : vols) {
+            if (series.size() != observations) throw std::invalid_argument("Historical series must cover the same dates");
+        }
+
+        // Day-major factor changes
+        const std::size_t days = observations - 1;
+        const std::size_t factors = closes.size() + vols.size();
+        std::vector<T> returns(days * factors);
+        for (std::size_t d = 0; d < days; ++d) {
+            T* row = returns.data() + d * factors;
+            for (std::size_t u = 0; u < closes.size(); ++u) {
+                if (!(closes[u][d] > 0) || !(closes[u][d + 1] > 0)) {
+                    throw std::invalid_argument("Historical closes must be positive");
+                }
+                row[u] = std::log(closes[u][d + 1] / closes[u][d]);
+            }
+            for (std::size_t u = 0; u < vols.size(); ++u) {
+                row[closes.size() + u] = vols[u][d + 1] - vols[u][d];
+            }
+        }
+        return fromReturns(returns, days, factors);
+    }
+
+    template<typename T>
+    void CovarianceMatrix<T>::multiply(std::span<const T> x, std::span<T> y) const {
+        if (x.size() != dimension_ || y.size() != dimension_) {
+            throw std::invalid_argument("Vector size does not match covariance dimension");
+        }
+        for (std::size_t i = 0; i < dimension_; ++i) {
+            const T* row = values_.data() + i * stride_;
+            T sum = 0;
+            for (std::size_t j = 0; j < dimension_; ++j) {
+                sum += row[j] * x[j];
+            }
+            y[i] = sum;
+        }
+    }
+
+    template<typename T>
+    T CovarianceMatrix<T>::quadraticForm(std::span<const T> x, std::span<const T> y) const {
+        std::vector<T> cy(dimension_);
+        multiply(y, cy);
+        T sum = 0;
+        for (std::size_t i = 0; i < dimension_; ++i) {
+            sum += x[i] * cy[i];
+        }
+        return sum;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class CovarianceMatrix<double>;
+    template class CovarianceMatrix<float>;
+}
\ No newline at end of file
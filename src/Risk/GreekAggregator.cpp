@@ -0,0 +1,207 @@
+// Same project headers.
+#include "Risk/GreekAggregator.h"
+#include "Core/AlignedAllocator.h"
+#include "Core/ParallelFor.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace QuantEngine {
+    namespace {
+        // One lane's accumulators; plain cells, with the buffer itself on its own cache lines
+        template<typename T>
+        using LaneCells = std::vector<GreekTotals<T>, AlignedAllocator<GreekTotals<T>>>;
+
+        // Finished lanes folded into the fixed pairwise tree over lane indices: node (level, k) covers
+        // lanes [k * 2^level, (k + 1) * 2^level) and is left += right of its two children, whichever
+        // finishes last doing the merge. A node without a right sibling moves up unchanged
+        // Merged-away buffers are reused, so live buffers track the workers rather than the lane count
+        template<typename T>
+        class LaneTree {
+        public:
+            LaneTree(std::size_t lanes, std::size_t cellCount) : lanes_(lanes), cellCount_(cellCount) {}
+
+            // Zeroed buffer for the next lane
+            LaneCells<T> acquire() {
+                LaneCells<T> cells;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!free_.empty()) {
+                        cells = std::move(free_.back());
+                        free_.pop_back();
+                    }
+                }
+                if (cells.empty()) {
+                    // Spare tail line so no other allocation shares the buffer's last line
+                    cells.reserve(cellCount_ + (64 + sizeof(GreekTotals<T>) - 1) / sizeof(GreekTotals<T>));
+                    cells.resize(cellCount_);
+                }
+                else {
+                    std::fill(cells.begin(), cells.end(), GreekTotals<T>{});
+                }
+                return cells;
+            }
+
+            // Folds a finished lane in, merging upwards while the sibling nodes are already there
+            void finish(std::size_t lane, LaneCells<T> node) {
+                std::size_t level = 0, index = lane;
+                while ((std::size_t{ 1 } << level) < lanes_) {
+                    const std::size_t sibling = index ^ 1;
+                    if ((sibling << level) < lanes_) {
+                        LaneCells<T> other;
+                        {
+                            std::lock_guard<std::mutex> lock(mutex_);
+                            const auto it = pending_.find({ level, sibling });
+                            if (it == pending_.end()) {
+                                pending_.emplace(std::make_pair(level, index), std::move(node));
+                                return;
+                            }
+                            other = std::move(it->second);
+                            pending_.erase(it);
+                        }
+                        if (index & 1) {
+                            std::swap(node, other);
+                        }
+                        for (std::size_t c = 0; c < cellCount_; ++c) {
+                            node[c] += other[c];
+                        }
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        free_.push_back(std::move(other));
+                    }
+                    index /= 2;
+                    ++level;
+                }
+                root_ = std::move(node);
+            }
+
+            // Sum of every lane once all have finished
+            LaneCells<T>& result() { return root_; }
+
+        private:
+            std::size_t lanes_;
+            std::size_t cellCount_;
+            std::mutex mutex_;
+            std::map<std::pair<std::size_t, std::size_t>, LaneCells<T>> pending_;   // (level, index) awaiting a sibling
+            std::vector<LaneCells<T>> free_;
+            LaneCells<T> root_;
+        };
+    }
+
+    template<typename T>
+    GreekTotals<T>& GreekTotals<T>::operator+=(const GreekTotals& other) {
+        delta += other.delta;
+        gamma += other.gamma;
+        vega += other.vega;
+        theta += other.theta;
+        rho += other.rho;
+        cashDelta += other.cashDelta;
+        cashGamma += other.cashGamma;
+        trades += other.trades;
+        return *this;
+    }
+
+    template<typename T>
+    GreekReport<T>::GreekReport(std::size_t underlyingCount, std::size_t bucketCount)
+        : underlyingCount_(underlyingCount), bucketCount_(bucketCount),
+        cells_(underlyingCount * bucketCount) {
+    }
+
+    template<typename T>
+    const GreekTotals<T>& GreekReport<T>::at(std::size_t underlying, std::size_t bucket) const {
+        if (underlying >= underlyingCount_ || bucket >= bucketCount_) {
+            throw std::out_of_range("Greek report cell out of range");
+        }
+        return cells_[underlying * bucketCount_ + bucket];
+    }
+
+    template<typename T>
+    GreekTotals<T> GreekReport<T>::underlyingTotal(std::size_t underlying) const {
+        GreekTotals<T> sum;
+        for (std::size_t b = 0; b < bucketCount_; ++b) {
+            sum += at(underlying, b);
+        }
+        return sum;
+    }
+
+    template<typename T>
+    GreekTotals<T> GreekReport<T>::total() const {
+        GreekTotals<T> sum;
+        for (const auto& cell : cells_) {
+            sum += cell;
+        }
+        return sum;
+    }
+
+    template<typename T>
+    GreekAggregator<T>::GreekAggregator(std::vector<T> bucketEdges) : edges_(std::move(bucketEdges)) {
+        for (std::size_t i = 0; i < edges_.size(); ++i) {
+            if (edges_[i] <= 0 || (i > 0 && edges_[i] <= edges_[i - 1])) {
+                throw std::invalid_argument("Maturity bucket edges must be positive and strictly increasing");
+            }
+        }
+    }
+
+    template<typename T>
+    std::size_t GreekAggregator<T>::bucket(T maturity) const {
+        return static_cast<std::size_t>(std::lower_bound(edges_.begin(), edges_.end(), maturity) - edges_.begin());
+    }
+
+    template<typename T>
+    GreekReport<T> GreekAggregator<T>::aggregate(const Portfolio<T>& portfolio, const PricingEngine<T>& engine,
+        unsigned threads) const {
+        const std::size_t rows = portfolio.size();
+        const std::size_t buckets = bucketCount();
+        const std::size_t cellCount = portfolio.underlyingCount() * buckets;
+
+        // Lane layout depends only on the row count
+        const std::size_t lanes = std::clamp<std::size_t>((rows + MinLaneRows - 1) / MinLaneRows, 1, MaxLanes);
+        const std::size_t laneRows = (rows + lanes - 1) / lanes;
+
+        LaneTree<T> tree(lanes, cellCount);
+
+        const auto maturities = portfolio.maturities();
+        const auto notionals = portfolio.notionals();
+        const auto underlyings = portfolio.underlyings();
+        const auto spots = portfolio.spots();
+
+        // Each lane sums its rows in order, so the result does not depend on scheduling
+        parallelFor(lanes, threads, [&](std::size_t lane) {
+            const std::size_t begin = lane * laneRows;
+            const std::size_t end = std::min(rows, begin + laneRows);
+            auto cells = tree.acquire();
+            for (std::size_t i = begin; i < end; ++i) {
+                const PortfolioRow<T> row(portfolio, i);
+                const auto greeks = engine.calculateGreeks(row, portfolio.market(underlyings[i]));
+                const T n = notionals[i];
+
+                auto& cell = cells[underlyings[i] * buckets + bucket(maturities[i])];
+                cell.delta += n * greeks[Greek::Delta];
+                cell.gamma += n * greeks[Greek::Gamma];
+                cell.vega += n * greeks[Greek::Vega];
+                cell.theta += n * greeks[Greek::Theta];
+                cell.rho += n * greeks[Greek::Rho];
+                cell.cashDelta += n * greeks[Greek::Delta] * spots[i];
+                cell.cashGamma += n * greeks[Greek::Gamma] * spots[i] * spots[i];
+                ++cell.trades;
+            }
+            tree.finish(lane, std::move(cells));
+        });
+
+        GreekReport<T> report(portfolio.underlyingCount(), buckets);
+        std::copy(tree.result().begin(), tree.result().end(), report.cells_.begin());
+        return report;
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template struct GreekTotals<double>;
+    template struct GreekTotals<float>;
+    template class GreekReport<double>;
+    template class GreekReport<float>;
+    template class GreekAggregator<double>;
+    template class GreekAggregator<float>;
+}
\ No newline at end of file
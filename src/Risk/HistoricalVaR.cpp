@@ -0,0 +1,146 @@
+// Same project headers.
+#include "Risk/HistoricalVaR.h"
+#include "Core/ParallelFor.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace QuantEngine {
+    template<typename T>
+    HistoricalScenarios<T>::HistoricalScenarios(std::size_t scenarioCount, std::size_t underlyingCount)
+        : scenarios_(scenarioCount), underlyings_(underlyingCount), moves_(scenarioCount * underlyingCount) {
+    }
+
+    template<typename T>
+    HistoricalScenarios<T> HistoricalScenarios<T>::fromHistory(const std::vector<std::vector<T>>& closes,
+        const std::vector<std::vector<T>>& vols, const std::vector<T>& rates) {
+        if (closes.empty() || closes.front().size() < 2) {
+            throw std::invalid_argument("Historical simulation needs at least two closes per underlying");
+        }
+        const std::size_t days = closes.front().size();
+        auto aligned = [days](std::size_t size) { return size == days; };
+        if (!std::all_of(closes.begin(), closes.end(), [&](const auto& c) { return aligned(c.size()); }) ||
+            (!vols.empty() && (vols.size() != closes.size() ||
+                !std::all_of(vols.begin(), vols.end(), [&](const auto& v) { return aligned(v.size()); }))) ||
+            (!rates.empty() && !aligned(rates.size()))) {
+            throw std::invalid_argument("Historical series must cover the same dates");
+        }
+
+        HistoricalScenarios result(days - 1, closes.size());
+        for (std::size_t d = 1; d < days; ++d) {
+            for (std::size_t u = 0; u < closes.size(); ++u) {
+                if (!(closes[u][d] > 0) || !(closes[u][d - 1] > 0)) {
+                    throw std::invalid_argument("Historical closes must be positive");
+                }
+                auto& move = result.move(d - 1, u);
+                move.spotReturn = std::log(closes[u][d] / closes[u][d - 1]);
+                move.volChange = vols.empty() ? T(0) : vols[u][d] - vols[u][d - 1];
+                move.rateChange = rates.empty() ? T(0) : rates[d] - rates[d - 1];
+            }
+        }
+        return result;
+    }
+
+    template<typename T>
+    ScenarioPnl<T>::ScenarioPnl(std::size_t scenarioCount, std::size_t tradeCount)
+        : scenarios_(scenarioCount), trades_(tradeCount),
+        stride_((tradeCount + 15) / 16 * 16),
+        values_(scenarioCount * stride_, 0.0f), totals_(scenarioCount, T(0)) {
+    }
+
+    template<typename T>
+    HistoricalVaR<T>::HistoricalVaR(std::shared_ptr<const BlackScholesEngine<T>> engine)
+        : engine_(std::move(engine)) {
+        if (!engine_) {
+            throw std::invalid_argument("Historical VaR needs a pricing engine");
+        }
+    }
+
+    template<typename T>
+    ScenarioPnl<T> HistoricalVaR<T>::revalue(const Portfolio<T>& portfolio, const HistoricalScenarios<T>& scenarios,
+        unsigned threads) const {
+        if (scenarios.underlyingCount() != portfolio.underlyingCount()) {
+            throw std::invalid_argument("Scenarios must cover every portfolio underlying");
+        }
+
+        // Base prices once, through the engine's batch path
+        const std::size_t trades = portfolio.size();
+        std::vector<T> base(trades);
+        engine_->calculatePrices(portfolio, base);
+
+        ScenarioPnl<T> pnl(scenarios.scenarioCount(), trades);
+
+        const auto notionals = portfolio.notionals();
+        const auto underlyings = portfolio.underlyings();
+
+        // Scenarios run independently; a scenario writes only its own row and total
+        parallelFor(scenarios.scenarioCount(), threads, [&](std::size_t s) {
+            // Shock each underlying's market once per scenario
+            std::vector<MarketData<T>> shocked;
+            shocked.reserve(portfolio.underlyingCount());
+            for (std::size_t u = 0; u < portfolio.underlyingCount(); ++u) {
+                const auto& move = scenarios.move(s, u);
+                shocked.push_back(portfolio.market(static_cast<typename Portfolio<T>::UnderlyingId>(u))
+                    .shocked(move.rateChange, move.volChange));
+            }
+
+            auto row = pnl.row(s);
+            T total = 0;
+            for (std::size_t i = 0; i < trades; ++i) {
+                auto params = portfolio.parameters(i);
+                params.spotPrice_ *= std::exp(scenarios.move(s, underlyings[i]).spotReturn);
+                const T value = notionals[i] * engine_->calculatePrice(PortfolioRow<T>(params), shocked[underlyings[i]]);
+                const T change = value - base[i];
+                row[i] = static_cast<float>(change);
+                total += change;
+            }
+            pnl.totals()[s] = total;
+        });
+        return pnl;
+    }
+
+    template<typename T>
+    RiskMeasure<T> HistoricalVaR<T>::measure(std::span<const T> pnl, T confidence) {
+        if (pnl.empty()) {
+            throw std::invalid_argument("No scenarios to measure");
+        }
+        if (!(confidence > 0 && confidence < 1)) {
+            throw std::invalid_argument("Confidence must lie in (0, 1)");
+        }
+
+        // Only the tail needs ordering
+        const std::size_t tail = std::clamp<std::size_t>(
+            static_cast<std::size_t>(std::ceil(static_cast<double>(pnl.size()) * (1 - static_cast<double>(confidence)) - 1e-9)),
+            1, pnl.size());
+        std::vector<T> sorted(pnl.begin(), pnl.end());
+        std::partial_sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(tail), sorted.end());
+
+        RiskMeasure<T> result;
+        result.tailCount = tail;
+        result.valueAtRisk = -sorted[tail - 1];
+        T sum = 0;
+        for (std::size_t k = 0; k < tail; ++k) {
+            sum += sorted[k];
+        }
+        result.expectedShortfall = -sum / static_cast<T>(tail);
+        return result;
+    }
+
+    template<typename T>
+    RiskMeasure<T> HistoricalVaR<T>::evaluate(const Portfolio<T>& portfolio, const HistoricalScenarios<T>& scenarios,
+        T confidence, unsigned threads) const {
+        const auto pnl = revalue(portfolio, scenarios, threads);
+        return measure(pnl.totals(), confidence);
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template class HistoricalScenarios<double>;
+    template class HistoricalScenarios<float>;
+    template class ScenarioPnl<double>;
+    template class ScenarioPnl<float>;
+    template class HistoricalVaR<double>;
+    template class HistoricalVaR<float>;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+// Same project headers.
+#include "Risk/ScenarioGrid.h"
+#include "Core/ParallelFor.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace QuantEngine {
+    namespace {
+        // Shocked vols are floored here so a large negative shock cannot divide by zero
+        template<typename T>
+        constexpr T MinVolatility = T(1e-4);
+
+        // Standard normal CDF via erfc (accurate in both tails)
+        template<typename T>
+        inline T normalCdf(T x) {
+            return T(0.5) * std::erfc(-x * T(0.70710678118654752440));
+        }
+    }
+
+    template<typename T>
+    ScenarioGrid<T>::ScenarioGrid(std::vector<T> spotShocks, std::vector<T> volShocks)
+        : spotShocks_(std::move(spotShocks)), volShocks_(std::move(volShocks)) {
+        if (spotShocks_.empty() || volShocks_.empty()) {
+            throw std::invalid_argument("Scenario grid needs at least one spot and one vol shock");
+        }
+        for (T s : spotShocks_) {
+            if (s <= -1) {
+                throw std::invalid_argument("Spot shocks must stay above -100%");
+            }
+            spotScale_.push_back(1 + s);
+            logSpotShift_.push_back(std::log1p(s));
+        }
+    }
+
+    template<typename T>
+    ScenarioGrid<T> ScenarioGrid<T>::ladder(T spotRange, std::size_t spotSteps, T volRange, std::size_t volSteps) {
+        auto axis = [](T range, std::size_t steps) {
+            std::vector<T> shocks(std::max<std::size_t>(steps, 1), T(0));
+            for (std::size_t k = 0; steps > 1 && k < steps; ++k) {
+                shocks[k] = -range + 2 * range * static_cast<T>(k) / static_cast<T>(steps - 1);
+            }
+            return shocks;
+        };
+        return ScenarioGrid(axis(spotRange, spotSteps), axis(volRange, volSteps));
+    }
+
+    template<typename T>
+    T ScenarioGrid<T>::accumulate(const Portfolio<T>& portfolio, std::size_t row, T* grid, T* scratch) const {
+        const MarketData<T>& market = portfolio.market(portfolio.underlyings()[row]);
+        const T n = portfolio.notionals()[row];
+        const T S = portfolio.spots()[row];
+        const T K = portfolio.strikes()[row];
+        const T t = portfolio.maturities()[row];
+        const bool isCall = portfolio.isCall()[row] != 0;
+
+        // Per-trade invariants, hoisted out of the grid
+        const T r = market.getRiskFreeRate(t);
+        const T sigma = market.getVolatility(K, t);
+        const T sqrtT = std::sqrt(t);
+        const T drift = std::log(S / K) + r * t;               // log-moneyness plus rT
+        const T nKdf = n * K * market.getDiscountFactor(t);    // Notional-scaled discounted strike
+
+        // Per-vol terms: sigma*sqrt(T), its reciprocal, and half the total variance
+        const std::size_t m = volShocks_.size();
+        T* volSqrt = scratch;
+        T* invVolSqrt = scratch + m;
+        T* halfVar = scratch + 2 * m;
+        for (std::size_t j = 0; j < m; ++j) {
+            volSqrt[j] = std::max(sigma + volShocks_[j], MinVolatility<T>) * sqrtT;
+            invVolSqrt[j] = 1 / volSqrt[j];
+            halfVar[j] = T(0.5) * volSqrt[j] * volSqrt[j];
+        }
+
+        // Sweep the grid; puts follow from parity so the inner loop has no branches
+        for (std::size_t i = 0; i < spotShocks_.size(); ++i) {
+            const T x = drift + logSpotShift_[i];
+            const T nS = n * S * spotScale_[i];
+            const T parity = isCall ? T(0) : nKdf - nS;
+            T* cells = grid + i * m;
+            for (std::size_t j = 0; j < m; ++j) {
+                const T d1 = (x + halfVar[j]) * invVolSqrt[j];
+                const T d2 = d1 - volSqrt[j];
+                cells[j] += nS * normalCdf(d1) - nKdf * normalCdf(d2) + parity;
+            }
+        }
+
+        // Unshocked value for P&L
+        const T baseVolSqrt = sigma * sqrtT;
+        const T d1 = (drift + T(0.5) * baseVolSqrt * baseVolSqrt) / baseVolSqrt;
+        const T call = n * S * normalCdf(d1) - nKdf * normalCdf(d1 - baseVolSqrt);
+        return isCall ? call : call - n * S + nKdf;
+    }
+
+    template<typename T>
+    ScenarioResult<T> ScenarioGrid<T>::revalue(const Portfolio<T>& portfolio, unsigned threads) const {
+        const std::size_t rows = portfolio.size();
+        const std::size_t cells = spotShocks_.size() * volShocks_.size();
+
+        // Lane layout depends only on the row count
+        const std::size_t lanes = std::clamp<std::size_t>((rows + MinLaneRows - 1) / MinLaneRows, 1, MaxLanes);
+        const std::size_t laneRows = (rows + lanes - 1) / lanes;
+
+        std::vector<std::vector<T>> grids(lanes, std::vector<T>(cells, T(0)));
+        std::vector<T> bases(lanes, T(0));
+
+        // Each lane sums its trades in order, so the result does not depend on scheduling
+        parallelFor(lanes, threads, [&](std::size_t lane) {
+            std::vector<T> scratch(3 * volShocks_.size());
+            const std::size_t begin = lane * laneRows;
+            const std::size_t end = std::min(rows, begin + laneRows);
+            for (std::size_t i = begin; i < end; ++i) {
+                bases[lane] += accumulate(portfolio, i, grids[lane].data(), scratch.data());
+            }
+        });
+
+        // Pairwise tree reduction, as in GreekAggregator
+        for (std::size_t stride = 1; stride < lanes; stride *= 2) {
+            for (std::size_t i = 0; i + stride < lanes; i += 2 * stride) {
+                for (std::size_t c = 0; c < cells; ++c) {
+                    grids[i][c] += grids[i + stride][c];
+                }
+                bases[i] += bases[i + stride];
+            }
+        }
+
+        ScenarioResult<T> result;
+        result.spotShocks = spotShocks_;
+        result.volShocks = volShocks_;
+        result.base = bases[0];
+        result.values = std::move(grids[0]);
+        return result;
+    }
+
+    template<typename T>
+    void ScenarioGrid<T>::revalueTrades(const Portfolio<T>& portfolio, std::span<T> out) const {
+        const std::size_t cells = spotShocks_.size() * volShocks_.size();
+        if (out.size() != portfolio.size() * cells) {
+            throw std::invalid_argument("Output size does not match trades x scenarios");
+        }
+
+        std::fill(out.begin(), out.end(), T(0));
+        std::vector<T> scratch(3 * volShocks_.size());
+        for (std::size_t i = 0; i < portfolio.size(); ++i) {
+            accumulate(portfolio, i, out.data() + i * cells, scratch.data());
+        }
+    }
+
+    // Explicit template instantiation prevents linker errors
+    template struct ScenarioResult<double>;
+    template struct ScenarioResult<float>;
+    template class ScenarioGrid<double>;
+    template class ScenarioGrid<float>;
+}
\ No newline at end of file
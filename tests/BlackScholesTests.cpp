@@ -28,7 +28,7 @@ namespace QuantEngine {
 
         // Dummy implementations for unused interface methods
         T price() const override { return 0; }
-        std::map<std::string, T> greeks() const override { return {}; }
+        QuantEngine::Greeks<T> greeks() const override { return {}; }
         void updateMarketData(const MarketData<T>&) override {}
         void setPricingEngine(std::shared_ptr<PricingEngine<T>>) override {}
         void validate() const override {}
@@ -97,11 +97,12 @@ TEST_CASE("BlackScholesEngine Greeks Calculation", "[PricingEngine][Greeks][Blac
         const auto greeks = engine.calculateGreeks(call, md);
 
         // Reference values from financial calculator
-        CHECK(greeks.at("delta") == Approx(0.6368).epsilon(tol));  // N(d1)
-        CHECK(greeks.at("gamma") == Approx(0.01876).epsilon(0.001)); // Gamma formula
-        CHECK(greeks.at("vega") == Approx(0.3752).epsilon(tol));   // Sensitivity to 1% vol change
-        CHECK(greeks.at("theta") == Approx(-0.0176).epsilon(0.01)); // Daily time decay
-        CHECK(greeks.at("rho") == Approx(0.5327).epsilon(tol));    // Sensitivity to 1% rate change
+        CHECK(greeks[QuantEngine::Greek::Delta] == Approx(0.6368).epsilon(tol));  // N(d1)
+        CHECK(greeks[QuantEngine::Greek::Gamma] == Approx(0.01876).epsilon(0.001)); // Gamma formula
+        CHECK(greeks[QuantEngine::Greek::Vega] == Approx(0.3752).epsilon(tol));   // Sensitivity to 1% vol change
+        CHECK(greeks[QuantEngine::Greek::Theta] == Approx(-0.0176).epsilon(0.01)); // Daily time decay
+        CHECK(greeks[QuantEngine::Greek::Rho] == Approx(0.5327).epsilon(tol));    // Sensitivity to 1% rate change
+        CHECK(QuantEngine::greekName(QuantEngine::Greek::Rho) == "rho");  // Display name only
     }
 
     SECTION("Put Option Greeks") {
@@ -109,11 +110,11 @@ TEST_CASE("BlackScholesEngine Greeks Calculation", "[PricingEngine][Greeks][Blac
         const auto greeks = engine.calculateGreeks(put, md);
 
         // Verify put-specific Greek calculations
-        CHECK(greeks.at("delta") == Approx(-0.3632).epsilon(tol));  // Call delta - 1
-        CHECK(greeks.at("gamma") == Approx(0.01876).epsilon(tol));  // Same gamma as call
-        CHECK(greeks.at("vega") == Approx(0.3752).epsilon(tol));    // Same vega as call
-        CHECK(greeks.at("theta") == Approx(-0.00454).margin(0.00001)); // Different theta formula
-        CHECK(greeks.at("rho") == Approx(-0.4189).epsilon(tol));    // Negative rate sensitivity
+        CHECK(greeks[QuantEngine::Greek::Delta] == Approx(-0.3632).epsilon(tol));  // Call delta - 1
+        CHECK(greeks[QuantEngine::Greek::Gamma] == Approx(0.01876).epsilon(tol));  // Same gamma as call
+        CHECK(greeks[QuantEngine::Greek::Vega] == Approx(0.3752).epsilon(tol));    // Same vega as call
+        CHECK(greeks[QuantEngine::Greek::Theta] == Approx(-0.00454).margin(0.00001)); // Different theta formula
+        CHECK(greeks[QuantEngine::Greek::Rho] == Approx(-0.4189).epsilon(tol));    // Negative rate sensitivity
     }
 
     SECTION("Extreme Volatility Handling") {
@@ -126,7 +127,7 @@ TEST_CASE("BlackScholesEngine Greeks Calculation", "[PricingEngine][Greeks][Blac
         const auto greeks = engine.calculateGreeks(call, highVolMd);
 
         // Verify vega decreases with higher volatility (convexity)
-        CHECK(greeks.at("vega") == Approx(0.3429).epsilon(0.001));
+        CHECK(greeks[QuantEngine::Greek::Vega] == Approx(0.3429).epsilon(0.001));
     }
 }
 
@@ -0,0 +1,94 @@
+// Same project headers.
+#include "PricingEngines/CachedPricingEngine.h"
+#include "PricingEngines/BlackScholesEngine.h"
+#include "Instruments/EuropeanStockOption.h"
+#include "Core/Portfolio.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <memory>
+#include <utility>
+#include <vector>
+
+// =================================================================
+// MEMOIZATION TESTS - Verify hits, market invalidation and eviction
+// =================================================================
+TEST_CASE("Cached Pricing Engine", "[PricingEngine][Cache]") {
+    auto inner = std::make_shared<QuantEngine::BlackScholesEngine<double>>();
+    auto cached = std::make_shared<QuantEngine::CachedPricingEngine<double>>(inner, 4, 1);
+
+    QuantEngine::MarketData<double> md;
+    md.addRiskFreeRate(1.0, 0.05);
+    md.addVolatility(100.0, 1.0, 0.2);
+
+    const QuantEngine::EuropeanStockOption<double> atm({ 1.0, 100.0, 1.0, 100.0, true });
+    const QuantEngine::EuropeanStockOption<double> atmLarge({ 1000.0, 100.0, 1.0, 100.0, true });
+
+    SECTION("Duplicate contracts priced once") {
+        const double first = cached->calculatePrice(atm, md);
+        const double second = cached->calculatePrice(atmLarge, md);  // Notional is not part of the key
+        CHECK(first == inner->calculatePrice(atm, md));
+        CHECK(second == first);
+        CHECK(cached->misses() == 1);
+        CHECK(cached->hits() == 1);
+
+        const auto greeks = cached->calculateGreeks(atm, md);
+        CHECK(greeks[QuantEngine::Greek::Delta] == inner->calculateGreeks(atm, md)[QuantEngine::Greek::Delta]);
+        CHECK(cached->size() == 1);  // Price and Greeks share one entry
+    }
+
+    SECTION("Market changes invalidate") {
+        const auto before = md.version();
+        const double first = cached->calculatePrice(atm, md);
+        md.addVolatility(100.0, 1.0, 0.3);
+        CHECK(md.version() != before);
+
+        const double second = cached->calculatePrice(atm, md);
+        CHECK(second > first);
+        CHECK(cached->misses() == 2);
+
+        const QuantEngine::MarketData<double> copy = md;
+        CHECK(copy.version() == md.version());
+    }
+
+    SECTION("LRU eviction bounds memory") {
+        for (int k = 0; k < 6; ++k) {
+            const QuantEngine::EuropeanStockOption<double> option({ 1.0, 95.0 + k, 1.0, 100.0, true });
+            cached->calculatePrice(option, md);
+        }
+        CHECK(cached->size() == 4);
+
+        // Oldest contracts were evicted, newest survive
+        const QuantEngine::EuropeanStockOption<double> newest({ 1.0, 100.0, 1.0, 100.0, true });
+        const QuantEngine::EuropeanStockOption<double> oldest({ 1.0, 95.0, 1.0, 100.0, true });
+        cached->calculatePrice(newest, md);
+        CHECK(cached->hits() == 1);
+        cached->calculatePrice(oldest, md);
+        CHECK(cached->misses() == 7);
+    }
+
+    SECTION("Total capacity holds across shards") {
+        for (const auto& [capacity, shards] : { std::pair<std::size_t, std::size_t>{ 5, 4 }, { 3, 16 }, { 17, 16 } }) {
+            QuantEngine::CachedPricingEngine<double> sharded(inner, capacity, shards);
+            for (int k = 0; k < 200; ++k) {
+                sharded.calculatePrice(QuantEngine::EuropeanStockOption<double>({ 1.0, 50.0 + k * 0.5, 1.0, 100.0, true }), md);
+            }
+            CHECK(sharded.size() <= capacity);
+            CHECK(sharded.size() > 0);
+        }
+    }
+
+    SECTION("Batch pricing over a portfolio") {
+        auto shared = std::make_shared<QuantEngine::MarketData<double>>(md);
+        QuantEngine::Portfolio<double> book;
+        const auto id = book.addUnderlying("AAPL", shared);
+        for (int i = 0; i < 10; ++i) {
+            book.addTrade(i, id, { 1.0 + i, 100.0, 1.0, 100.0, true });
+        }
+
+        std::vector<double> prices(book.size());
+        cached->calculatePrices(book, prices);
+        CHECK(cached->misses() == 1);
+        CHECK(prices[9] == Approx(10.0 * prices[0]));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+// Same project headers.
+#include "Risk/DeltaGammaVaR.h"
+#include "PricingEngines/BlackScholesEngine.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+// =================================================================
+// COVARIANCE TESTS - Verify blocked estimation against a direct sum
+// =================================================================
+TEST_CASE("Blocked Covariance Estimation", "[Risk][Covariance]") {
+    // 300 days x 5 factors of correlated noise (spans several day blocks)
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.01);
+    const std::size_t days = 300, factors = 5;
+    std::vector<double> returns(days * factors);
+    for (std::size_t d = 0; d < days; ++d) {
+        const double common = noise(rng);
+        for (std::size_t a = 0; a < factors; ++a) {
+            returns[d * factors + a] = common + noise(rng) * static_cast<double>(a + 1) + 0.001;
+        }
+    }
+
+    const auto cov = QuantEngine::CovarianceMatrix<double>::fromReturns(returns, days, factors);
+    for (std::size_t a = 0; a < factors; ++a) {
+        for (std::size_t b = 0; b < factors; ++b) {
+            double ma = 0, mb = 0, sum = 0;
+            for (std::size_t d = 0; d < days; ++d) {
+                ma += returns[d * factors + a];
+                mb += returns[d * factors + b];
+            }
+            ma /= days;
+            mb /= days;
+            for (std::size_t d = 0; d < days; ++d) {
+                sum += (returns[d * factors + a] - ma) * (returns[d * factors + b] - mb);
+            }
+            CHECK(cov(a, b) == Approx(sum / (days - 1)).epsilon(1e-10));
+        }
+    }
+
+    const auto fromCloses = QuantEngine::CovarianceMatrix<double>::fromCloses({ { 100, 101, 99, 102 }, { 50, 50.5, 49.5, 51 } });
+    CHECK(fromCloses.dimension() == 2);
+    CHECK(fromCloses(0, 1) == fromCloses(1, 0));
+}
+
+// =================================================================
+// PARAMETRIC VAR TESTS - Verify delta-normal limit and gamma effects
+// =================================================================
+TEST_CASE("Delta-Gamma VaR", "[Risk][VaR]") {
+    QuantEngine::CovarianceMatrix<double> cov(2);
+    cov(0, 0) = 0.0004;    // 2% daily vol
+    cov(1, 1) = 0.0009;    // 3% daily vol
+    cov(0, 1) = cov(1, 0) = 0.5 * 0.02 * 0.03;
+
+    SECTION("Linear book is delta-normal") {
+        const std::vector<double> linear{ 1000.0, -500.0 }, gamma{ 0.0, 0.0 };
+        const auto risk = QuantEngine::DeltaGammaVaR<double>::evaluate(linear, gamma, cov, 0.99);
+        const double sigma = std::sqrt(1000.0 * 1000.0 * 0.0004 + 500.0 * 500.0 * 0.0009 - 2 * 1000.0 * 500.0 * 0.0003);
+        CHECK(risk.standardDeviation == Approx(sigma));
+        CHECK(risk.skewness == 0.0);
+        CHECK(risk.valueAtRisk == Approx(2.326348 * sigma).epsilon(1e-5));
+        CHECK(risk.expectedShortfall == Approx(2.665214 * sigma).epsilon(1e-3));
+    }
+
+    SECTION("Long gamma shifts the mean and shortens the loss tail") {
+        const std::vector<double> linear{ 1000.0, 0.0 }, flat{ 0.0, 0.0 }, longGamma{ 20000.0, 0.0 };
+        const auto base = QuantEngine::DeltaGammaVaR<double>::evaluate(linear, flat, cov, 0.99);
+        const auto convex = QuantEngine::DeltaGammaVaR<double>::evaluate(linear, longGamma, cov, 0.99);
+        CHECK(convex.mean == Approx(0.5 * 20000.0 * 0.0004));
+        CHECK(convex.skewness > 0);
+        CHECK(convex.valueAtRisk < base.valueAtRisk);
+    }
+
+    SECTION("From aggregated Greeks with vega factors") {
+        auto md = std::make_shared<QuantEngine::MarketData<double>>();
+        md->addRiskFreeRate(1.0, 0.05);
+        md->addVolatility(100.0, 1.0, 0.2);
+        QuantEngine::Portfolio<double> book;
+        const auto a = book.addUnderlying("A", md);
+        const auto b = book.addUnderlying("B", md);
+        book.addTrade(1, a, { 100.0, 100.0, 1.0, 100.0, true });
+        book.addTrade(2, b, { 50.0, 100.0, 1.0, 100.0, false });
+
+        const QuantEngine::BlackScholesEngine<double> engine;
+        const auto report = QuantEngine::GreekAggregator<double>({}).aggregate(book, engine, 1);
+
+        QuantEngine::CovarianceMatrix<double> withVol(4);
+        for (std::size_t i = 0; i < 2; ++i) {
+            for (std::size_t j = 0; j < 2; ++j) withVol(i, j) = cov(i, j);
+        }
+        withVol(2, 2) = withVol(3, 3) = 0.0001;  // 1 vol point daily
+
+        const auto spotOnly = QuantEngine::DeltaGammaVaR<double>::evaluate(report, cov);
+        const auto spotAndVol = QuantEngine::DeltaGammaVaR<double>::evaluate(report, withVol);
+        CHECK(spotOnly.valueAtRisk > 0);
+        CHECK(spotAndVol.standardDeviation > spotOnly.standardDeviation);
+        CHECK_THROWS_AS(QuantEngine::DeltaGammaVaR<double>::evaluate(report, QuantEngine::CovarianceMatrix<double>(3)),
+            std::invalid_argument);
+    }
+}
\ No newline at end of file
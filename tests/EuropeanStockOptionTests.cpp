@@ -7,6 +7,35 @@
 // std headers.
 #include <memory>
 
+namespace {
+    // Black-Scholes engine that counts calculations and can announce setting changes
+    class CountingEngine : public QuantEngine::BlackScholesEngine<double> {
+    public:
+        mutable int prices = 0;
+        mutable int greeks = 0;
+
+        double calculatePrice(const QuantEngine::Instrument<double>& instrument,
+            const QuantEngine::MarketData<double>& marketData) const override {
+            ++prices;
+            return BlackScholesEngine::calculatePrice(instrument, marketData);
+        }
+
+        QuantEngine::Greeks<double> calculateGreeks(const QuantEngine::Instrument<double>& instrument,
+            const QuantEngine::MarketData<double>& marketData) const override {
+            ++greeks;
+            return BlackScholesEngine::calculateGreeks(instrument, marketData);
+        }
+
+        // Simulates a change of engine settings
+        void changed() { notifyObservers(); }
+    };
+
+    // Counts notifications from an instrument
+    struct CountingObserver : QuantEngine::Observer {
+        int updates = 0;
+        void update() override { ++updates; }
+    };
+}
 
 // =================================================================
 // Construction TESTS - Validate parameter validation during object creation
@@ -100,6 +129,67 @@ TEST_CASE("EuropeanStockOption Parameter Integrity", "[EuropeanStockOption][Para
     }
 }
 
+// =================================================================
+// Lazy evaluation TESTS - Verify cached results and invalidation
+// =================================================================
+
+TEST_CASE("EuropeanStockOption Lazy Results", "[EuropeanStockOption][Cache]") {
+    QuantEngine::EuropeanStockOption<double> option({ 1.0, 100.0, 1.0, 100.0, true });
+    auto engine = std::make_shared<CountingEngine>();
+    QuantEngine::MarketData<double> md;
+    md.addRiskFreeRate(1.0, 0.05);
+    md.addVolatility(100.0, 1.0, 0.2);
+
+    option.setPricingEngine(engine);
+    option.updateMarketData(md);
+    CountingObserver observer;
+    option.registerObserver(&observer);
+
+    SECTION("Repeat calls reuse results") {
+        const double first = option.price();
+        CHECK(option.price() == first);
+        option.greeks();
+        option.greeks();
+        CHECK(engine->prices == 1);
+        CHECK(engine->greeks == 1);
+    }
+
+    SECTION("Market data invalidates") {
+        const double before = option.price();
+        md.addVolatility(100.0, 1.0, 0.3);
+        option.updateMarketData(md);
+        CHECK(observer.updates == 1);
+        CHECK(option.price() > before);
+        CHECK(engine->prices == 2);
+    }
+
+    SECTION("Engine notifications invalidate") {
+        option.price();
+        engine->changed();
+        CHECK(observer.updates == 1);
+        option.price();
+        CHECK(engine->prices == 2);
+    }
+
+    SECTION("Parameter changes invalidate and validate") {
+        const double atm = option.price();
+        option.setParameters({ 2.0, 100.0, 1.0, 100.0, true });
+        CHECK(option.price() == Approx(2.0 * atm));
+        CHECK_THROWS_AS(option.setParameters({ 1.0, -1.0, 1.0, 100.0, true }), std::invalid_argument);
+        CHECK(option.getParameters().notional_ == 2.0);  // Rejected terms leave the option unchanged
+    }
+
+    SECTION("Replacing the engine stops old notifications") {
+        option.setPricingEngine(std::make_shared<QuantEngine::BlackScholesEngine<double>>());
+        CHECK(engine->observerCount() == 0);
+        const int updates = observer.updates;
+        engine->changed();
+        CHECK(observer.updates == updates);
+    }
+
+    option.unregisterObserver(&observer);
+}
+
 // =================================================================
 // Template TESTS - Verify numeric type support (float/double)
 // =================================================================
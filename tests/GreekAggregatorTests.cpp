@@ -0,0 +1,81 @@
+// Same project headers.
+#include "Risk/GreekAggregator.h"
+#include "Instruments/EuropeanStockOption.h"
+#include "PricingEngines/BlackScholesEngine.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <memory>
+
+// =================================================================
+// AGGREGATION TESTS - Verify grouping, weighting and determinism
+// =================================================================
+TEST_CASE("Greek Aggregation By Underlying And Bucket", "[Risk][Greeks]") {
+    auto md = std::make_shared<QuantEngine::MarketData<double>>();
+    md->addRiskFreeRate(0.25, 0.03);
+    md->addRiskFreeRate(2.0, 0.05);
+    md->addVolatility(80.0, 0.25, 0.25);
+    md->addVolatility(80.0, 2.0, 0.22);
+    md->addVolatility(120.0, 0.25, 0.21);
+    md->addVolatility(120.0, 2.0, 0.19);
+
+    QuantEngine::Portfolio<double> book;
+    const auto aapl = book.addUnderlying("AAPL", md);
+    const auto msft = book.addUnderlying("MSFT", md);
+
+    // Enough rows to spread over several lanes, all strictly inside the vol grid
+    const std::size_t rows = 5000;
+    for (std::size_t i = 0; i < rows; ++i) {
+        const double strike = 85.0 + static_cast<double>(i % 31);
+        const double maturity = 0.3 + 1.6 * static_cast<double>(i % 7) / 6.0;
+        book.addTrade(i, i % 3 ? aapl : msft, { 1.0 + static_cast<double>(i % 5), strike, maturity, 100.0, i % 2 == 0 });
+    }
+
+    const QuantEngine::BlackScholesEngine<double> engine;
+    const QuantEngine::GreekAggregator<double> aggregator({ 0.5, 1.0 });
+
+    SECTION("Bucketing") {
+        CHECK(aggregator.bucketCount() == 3);
+        CHECK(aggregator.bucket(0.25) == 0);
+        CHECK(aggregator.bucket(0.5) == 0);
+        CHECK(aggregator.bucket(0.75) == 1);
+        CHECK(aggregator.bucket(2.0) == 2);
+        CHECK_THROWS_AS(QuantEngine::GreekAggregator<double>({ 1.0, 0.5 }), std::invalid_argument);
+    }
+
+    SECTION("Matches a serial per-trade sum") {
+        const auto report = aggregator.aggregate(book, engine, 4);
+
+        double delta = 0.0, vega = 0.0, cashGamma = 0.0;
+        std::size_t msftBucket1 = 0;
+        for (std::size_t i = 0; i < rows; ++i) {
+            const auto params = book.parameters(i);
+            QuantEngine::EuropeanStockOption<double> option(params);
+            const auto greeks = engine.calculateGreeks(option, *md);
+            delta += params.notional_ * greeks[QuantEngine::Greek::Delta];
+            vega += params.notional_ * greeks[QuantEngine::Greek::Vega];
+            cashGamma += params.notional_ * greeks[QuantEngine::Greek::Gamma] * params.spotPrice_ * params.spotPrice_;
+            if (book.underlyings()[i] == msft && aggregator.bucket(params.maturity_) == 1) ++msftBucket1;
+        }
+
+        CHECK(report.total().trades == rows);
+        CHECK(report.total().delta == Approx(delta));
+        CHECK(report.total().vega == Approx(vega));
+        CHECK(report.total().cashGamma == Approx(cashGamma));
+        CHECK(report.at(msft, 1).trades == msftBucket1);
+        CHECK(report.underlyingTotal(aapl).trades + report.underlyingTotal(msft).trades == rows);
+        CHECK_THROWS_AS(report.at(2, 0), std::out_of_range);
+    }
+
+    SECTION("Independent of thread count") {
+        const auto serial = aggregator.aggregate(book, engine, 1);
+        const auto parallel = aggregator.aggregate(book, engine, 8);
+        for (std::size_t u = 0; u < 2; ++u) {
+            for (std::size_t b = 0; b < 3; ++b) {
+                CHECK(serial.at(u, b).delta == parallel.at(u, b).delta);
+                CHECK(serial.at(u, b).gamma == parallel.at(u, b).gamma);
+                CHECK(serial.at(u, b).rho == parallel.at(u, b).rho);
+            }
+        }
+    }
+}
\ No newline at end of file
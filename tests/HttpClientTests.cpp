@@ -0,0 +1,139 @@
+// Same project headers.
+#include "Core/HttpClient.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Writes body to a scratch file and returns its file:// URL, so requests run without a network
+    std::string fileUrl(const std::string& name, const std::string& body) {
+        const auto path = std::filesystem::temp_directory_path() / ("quantengine_" + name);
+        std::ofstream(path, std::ios::binary) << body;
+        return "file://" + path.string();
+    }
+}
+
+// =================================================================
+// HANDLE REUSE TESTS - Verify one persistent handle per thread
+// =================================================================
+TEST_CASE("HttpClient Handle Reuse", "[HttpClient]") {
+    const std::string url = fileUrl("http_client.json", "{\"price\": \"101.5\"}");
+
+    SECTION("Repeat requests on a thread reuse its handle") {
+        CHECK(QuantEngine::HttpClient::get(url) == "{\"price\": \"101.5\"}");
+        const auto created = QuantEngine::HttpClient::handlesCreated();
+        for (int i = 0; i < 5; ++i) {
+            CHECK(QuantEngine::HttpClient::get(url) == "{\"price\": \"101.5\"}");
+        }
+        CHECK(QuantEngine::HttpClient::handlesCreated() == created);
+    }
+
+    SECTION("Each thread gets its own handle") {
+        QuantEngine::HttpClient::get(url);
+        const auto created = QuantEngine::HttpClient::handlesCreated();
+        std::string body;
+        std::thread worker([&] { body = QuantEngine::HttpClient::get(url); });
+        worker.join();
+        CHECK(body == "{\"price\": \"101.5\"}");
+        CHECK(QuantEngine::HttpClient::handlesCreated() == created + 1);
+    }
+
+    SECTION("A failed transfer throws and leaves the handle usable") {
+        const auto created = QuantEngine::HttpClient::handlesCreated();
+        CHECK_THROWS_AS(QuantEngine::HttpClient::get("file:///nonexistent/quantengine/missing"), std::runtime_error);
+        CHECK(QuantEngine::HttpClient::get(url) == "{\"price\": \"101.5\"}");
+        CHECK(QuantEngine::HttpClient::handlesCreated() <= created + 1);
+    }
+}
+
+// =================================================================
+// BATCH TESTS - Verify concurrent transfers keep order and isolate failures
+// =================================================================
+TEST_CASE("HttpClient Concurrent Batch", "[HttpClient][Multi]") {
+    std::vector<std::string> urls;
+    for (int i = 0; i < 40; ++i) {
+        urls.push_back(fileUrl("http_batch_" + std::to_string(i) + ".txt", "body " + std::to_string(i)));
+    }
+    urls[7] = "file:///nonexistent/quantengine/missing";
+
+    for (std::size_t limit : { std::size_t(1), std::size_t(4), std::size_t(64) }) {
+        const auto responses = QuantEngine::HttpClient::getAll(urls, limit);
+        REQUIRE(responses.size() == urls.size());
+        for (std::size_t i = 0; i < urls.size(); ++i) {
+            if (i == 7) {
+                CHECK_FALSE(responses[i].ok());
+                CHECK(responses[i].body.empty());
+            }
+            else {
+                CHECK(responses[i].ok());
+                CHECK(responses[i].body == "body " + std::to_string(i));
+            }
+        }
+    }
+
+    CHECK(QuantEngine::HttpClient::getAll({}, 4).empty());
+    CHECK_THROWS_AS(QuantEngine::HttpClient::getAll(urls, 0), std::invalid_argument);
+}
+
+// =================================================================
+// REACTOR TESTS - Verify asynchronous submission on the I/O thread
+// =================================================================
+TEST_CASE("HttpClient Reactor", "[HttpClient][Reactor]") {
+    using Reactor = QuantEngine::HttpClient::Reactor;
+    using namespace std::chrono_literals;
+    std::vector<std::string> urls;
+    for (int i = 0; i < 24; ++i) {
+        urls.push_back(fileUrl("http_reactor_" + std::to_string(i) + ".txt", "reactor " + std::to_string(i)));
+    }
+
+    SECTION("Futures resolve while the caller keeps working") {
+        Reactor reactor(4);
+        std::vector<std::future<QuantEngine::HttpClient::Response>> futures;
+        for (const auto& url : urls) {
+            futures.push_back(reactor.get(url));
+        }
+        auto failed = reactor.get("file:///nonexistent/quantengine/missing");
+        for (std::size_t i = 0; i < urls.size(); ++i) {
+            const auto response = futures[i].get();
+            CHECK(response.ok());
+            CHECK(response.body == "reactor " + std::to_string(i));
+        }
+        CHECK_FALSE(failed.get().ok());
+        CHECK(reactor.pending() == 0);
+    }
+
+    SECTION("Callbacks run on the reactor thread and may throw") {
+        Reactor reactor(2);
+        std::promise<std::thread::id> where;
+        reactor.submit(urls[0], [](QuantEngine::HttpClient::Response) { throw std::runtime_error("ignored"); });
+        reactor.submit(urls[1], [&where](QuantEngine::HttpClient::Response) { where.set_value(std::this_thread::get_id()); });
+        CHECK(where.get_future().get() != std::this_thread::get_id());
+    }
+
+    SECTION("Held requests wait for their start time") {
+        Reactor reactor(2);
+        const auto start = Reactor::Clock::now();
+        auto held = reactor.get(urls[2], start + 60ms);
+        auto immediate = reactor.get(urls[3]);
+        CHECK(immediate.get().body == "reactor 3");
+        CHECK(held.get().body == "reactor 2");
+        CHECK(Reactor::Clock::now() - start >= 60ms);
+    }
+
+    SECTION("Stopping fails outstanding requests") {
+        std::future<QuantEngine::HttpClient::Response> orphan;
+        {
+            Reactor reactor(1);
+            orphan = reactor.get(urls[4], Reactor::Clock::now() + 1h);
+        }
+        const auto response = orphan.get();
+        CHECK_FALSE(response.ok());
+        CHECK(response.error == "HTTP reactor stopped");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+// Same project headers.
+#include "Core/HttpTransport.h"
+#include "Core/HttpClient.h"
+#include "Core/ConfigManager.h"
+#include "Core/DataFetcher.h"
+#include "Core/MarketData.h"
+#include "Core/ResponseCache.h"
+#include "Core/Portfolio.h"
+#include "PricingEngines/BlackScholesEngine.h"
+#include "TestHelpers.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using Transport = QuantEngine::HttpTransport;
+    using QuantEngine::scratch;
+
+    const std::string FredUrl = "https://api.stlouisfed.org/fred/series/observations?series_id=DTB3&api_key=RECORDED"
+        "&file_type=json&sort_order=desc&limit=1";
+
+    // Recorded provider payloads for one symbol (daily closes 100.5 .. 130.5, newest first)
+    void recordProviderFixtures(const std::string& symbol) {
+        Transport::record("https://www.alphavantage.co/query?function=GLOBAL_QUOTE&symbol=" + symbol + "&apikey=RECORDED",
+            "{\"Global Quote\": {\"01. symbol\": \"" + symbol + "\", \"05. price\": \"125.00\"}}");
+
+        // Newest entry is a session that has not closed yet, far off the others
+        std::string daily = "{\"Time Series (Daily)\": {\"9999-12-31\": {\"4. close\": \"1000.0\"},";
+        for (int d = 31; d >= 1; --d) {
+            const double close = 100.5 + (d - 1) + (d % 2 ? 1.5 : -1.5);
+            daily += "\"2024-01-" + std::string(d < 10 ? "0" : "") + std::to_string(d) + "\": {\"4. close\": \"" +
+                std::to_string(close) + "\"}" + (d > 1 ? "," : "");
+        }
+        Transport::record("https://www.alphavantage.co/query?function=TIME_SERIES_DAILY&symbol=" + symbol +
+            "&apikey=RECORDED&outputsize=compact", daily + "}}");
+
+        Transport::record(FredUrl, "{\"observations\": [{\"date\": \"2024-01-31\", \"value\": \"5.25\"}]}");
+    }
+}
+
+// =================================================================
+// RECORD / REPLAY TESTS - Verify fixtures stand in for the network
+// =================================================================
+TEST_CASE("HTTP Transport Record and Replay", "[HttpTransport]") {
+    QuantEngine::FetcherStateGuard restore;
+    const auto fixtures = scratch("transport_fixtures");
+    const auto source = scratch("transport_source");
+    std::vector<std::string> urls;
+    for (int i = 0; i < 4; ++i) {
+        const auto path = source / ("payload_" + std::to_string(i) + ".txt");
+        std::ofstream(path, std::ios::binary) << "payload " << i;
+        urls.push_back("file://" + path.string());
+    }
+
+    SECTION("Fixture names are readable and credential-free") {
+        const auto a = Transport::fixturePath(fixtures, "https://www.alphavantage.co/query?function=GLOBAL_QUOTE&symbol=IBM&apikey=SECRET");
+        const auto b = Transport::fixturePath(fixtures, "https://www.alphavantage.co/query?apikey=OTHER&symbol=IBM&function=GLOBAL_QUOTE");
+        CHECK(a == b);
+        CHECK(a.filename().string().find("SECRET") == std::string::npos);
+        CHECK(a.filename().string().find("GLOBAL_QUOTE") != std::string::npos);
+
+        // Over-long keys end in the portable key hash, so fixtures move between platforms
+        const std::string url = "https://www.alphavantage.co/query?function=GLOBAL_QUOTE&symbol=" + std::string(200, 'X');
+        const std::string name = Transport::fixturePath(fixtures, url).filename().string();
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx",
+            static_cast<unsigned long long>(QuantEngine::ResponseCache::keyHash(QuantEngine::ResponseCache::normalize(url).substr(8))));
+        CHECK(name == name.substr(0, 180) + "_" + hash + ".body");
+    }
+
+    SECTION("Recorded live bodies replay without the source") {
+        Transport::configure({ Transport::Mode::Record, fixtures });
+        CHECK(QuantEngine::HttpClient::get(urls[0]) == "payload 0");
+        const auto batch = QuantEngine::HttpClient::getAll(std::vector<std::string>(urls.begin() + 1, urls.end()), 2);
+        CHECK(batch[2].body == "payload 3");
+
+        std::filesystem::remove_all(source);
+        Transport::configure({ Transport::Mode::Replay, fixtures });
+        CHECK(QuantEngine::HttpClient::get(urls[0]) == "payload 0");
+        const auto replayed = QuantEngine::HttpClient::getAll(urls, 4);
+        for (std::size_t i = 0; i < urls.size(); ++i) {
+            CHECK(replayed[i].body == "payload " + std::to_string(i));
+        }
+        QuantEngine::HttpClient::Reactor reactor(2);
+        CHECK(reactor.get(urls[3]).get().body == "payload 3");
+
+        // Nothing recorded, nothing served
+        CHECK_THROWS_AS(QuantEngine::HttpClient::get("https://example.com/never"), std::runtime_error);
+        CHECK_FALSE(reactor.get("https://example.com/never").get().ok());
+    }
+
+    SECTION("Replay latency is simulated per concurrency slot") {
+        Transport::configure({ Transport::Mode::Replay, fixtures, std::chrono::milliseconds(30), std::chrono::milliseconds(0) });
+        for (int i = 0; i < 4; ++i) Transport::record(urls[i], "x");
+
+        const auto start = std::chrono::steady_clock::now();
+        QuantEngine::HttpClient::getAll(urls, 2);     // Two waves of two
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        CHECK(elapsed >= std::chrono::milliseconds(60));
+        CHECK(elapsed < std::chrono::milliseconds(1000));
+    }
+
+    SECTION("Jitter is repeatable for a seed") {
+        Transport::configure({ Transport::Mode::Replay, fixtures, std::chrono::milliseconds(20), std::chrono::milliseconds(10), 7 });
+        std::vector<long long> first, second;
+        for (int i = 0; i < 8; ++i) first.push_back(Transport::nextLatency().count());
+        Transport::configure({ Transport::Mode::Replay, fixtures, std::chrono::milliseconds(20), std::chrono::milliseconds(10), 7 });
+        for (int i = 0; i < 8; ++i) second.push_back(Transport::nextLatency().count());
+        CHECK(first == second);
+        for (long long ms : first) CHECK((ms >= 10 && ms <= 30));
+    }
+
+    CHECK_THROWS_AS(Transport::configure({ Transport::Mode::Replay, {} }), std::invalid_argument);
+    Transport::configure({});
+    CHECK_THROWS_AS(Transport::record(urls[0], "x"), std::logic_error);
+}
+
+// =================================================================
+// END-TO-END TESTS - Verify fetch -> price runs offline from fixtures
+// =================================================================
+TEST_CASE("Replayed Fetch to Price", "[HttpTransport][DataFetcher]") {
+    // Keeps the disk cache and price store out of the measurement; replays are not paced
+    QuantEngine::FetcherStateGuard restore;
+
+    // Any key works: fixtures are keyed without credentials
+    const auto config = scratch("transport_config") / "config.json";
+    std::ofstream(config) << "{\"api_keys\": {\"alpha_vantage\": \"DUMMY\", \"fred\": \"DUMMY\"}}";
+    QuantEngine::ConfigManager::getInstance().loadConfig(config.string());
+
+    const auto fixtures = scratch("transport_e2e");
+    Transport::configure({ Transport::Mode::Record, fixtures });
+    recordProviderFixtures("IBM");
+    recordProviderFixtures("MSFT");
+    Transport::configure({ Transport::Mode::Replay, fixtures, std::chrono::milliseconds(5), std::chrono::milliseconds(2) });
+
+    const auto data = QuantEngine::DataFetcher::fetchStockData("IBM");
+    CHECK(data.spotPrice == 125.0);
+    CHECK(data.riskFreeRate == Approx(0.0525));
+    CHECK(data.volatility > 0.3);     // Alternating closes, far from the 30% fallback
+
+    // Blocking, batched and async paths agree
+    const std::vector<std::string> watchlist{ "IBM", "MSFT", "NOPE" };
+    const auto batch = QuantEngine::DataFetcher::fetchStockData(std::span<const std::string>(watchlist), 4);
+    REQUIRE(batch[0]);
+    REQUIRE(batch[1]);
+    CHECK_FALSE(batch[2]);
+    CHECK(batch[0]->volatility == Approx(data.volatility));
+    const auto async = QuantEngine::DataFetcher::fetchStockDataAsync("MSFT").get();
+    CHECK(async.volatility == Approx(batch[1]->volatility));
+
+    // Every path drops the unfinished session the same way
+    CHECK(QuantEngine::DataFetcher::fetchHistoricalPrices("IBM", "KEY", 5).back() == Approx(132.0));
+    CHECK(QuantEngine::DataFetcher::fetchHistoricalPricesAsync("IBM", "KEY", 5).get().back() == Approx(132.0));
+    CHECK(QuantEngine::DataFetcher::fetchHistoricalVolatilityAsync("IBM", "KEY").get() == Approx(data.volatility));
+    CHECK(QuantEngine::DataFetcher::fetchStockDataAsync("IBM").get().volatility == Approx(data.volatility));
+
+    // Price off the replayed market
+    QuantEngine::MarketData<double> market;
+    market.addRiskFreeRate(1.0, data.riskFreeRate);
+    market.addVolatility(125.0, 1.0, data.volatility);
+    const QuantEngine::PortfolioRow<double> option(QuantEngine::Instrument<double>::Parameters{ 1.0, 125.0, 1.0, data.spotPrice, true });
+    const double price = QuantEngine::BlackScholesEngine<double>().calculatePrice(option, market);
+    CHECK(std::isfinite(price));
+    CHECK(price > 0.0);
+}
+
+TEST_CASE("Missing FRED Rate Is Not Remembered", "[HttpTransport][DataFetcher]") {
+    QuantEngine::FetcherStateGuard restore;
+
+    const auto config = scratch("transport_rate_config") / "config.json";
+    std::ofstream(config) << "{\"api_keys\": {\"alpha_vantage\": \"DUMMY\", \"fred\": \"DUMMY\"}}";
+    QuantEngine::ConfigManager::getInstance().loadConfig(config.string());
+
+    const auto cache = std::make_shared<QuantEngine::ResponseCache>(scratch("transport_rate_cache"));
+    QuantEngine::DataFetcher::setResponseCache(cache);
+    Transport::configure({ Transport::Mode::Replay, scratch("transport_rate") });
+
+    // FRED publishes "." until the day's value is in: no rate, and nothing memoized or cached
+    Transport::record(FredUrl, "{\"observations\": [{\"date\": \"2024-01-31\", \"value\": \".\"}]}");
+    CHECK_THROWS_AS(QuantEngine::DataFetcher::fetchRiskFreeRate(), std::runtime_error);
+    CHECK_THROWS_AS(QuantEngine::DataFetcher::fetchRiskFreeRateAsync().get(), std::runtime_error);
+    CHECK_FALSE(cache->lookup(FredUrl));
+
+    // The next call sees the published value
+    Transport::record(FredUrl, "{\"observations\": [{\"date\": \"2024-01-31\", \"value\": \"5.25\"}]}");
+    CHECK(QuantEngine::DataFetcher::fetchRiskFreeRate() == Approx(0.0525));
+    CHECK(cache->lookup(FredUrl));
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+// Same project headers.
+#include "Core/InstrumentArena.h"
+#include "PricingEngines/BlackScholesEngine.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cstddef>
+#include <memory_resource>
+
+namespace {
+    // Upstream resource that counts the blocks the arena requests
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        std::size_t allocations = 0;
+        std::size_t live = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            ++live;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            --live;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    // Records destruction so reset() can be observed
+    struct Tracked {
+        int* destroyed;
+        ~Tracked() { ++*destroyed; }
+    };
+}
+
+// =================================================================
+// ARENA TESTS - Verify bulk construction, pricing and one-step teardown
+// =================================================================
+TEST_CASE("Instrument Arena Bulk Loading", "[InstrumentArena]") {
+    CountingResource upstream;
+    QuantEngine::MarketData<double> md;
+    md.addRiskFreeRate(1.0, 0.05);
+    md.addVolatility(100.0, 1.0, 0.2);
+
+    SECTION("Options and engine live in a handful of blocks") {
+        QuantEngine::InstrumentArena arena(1 << 16, &upstream);
+        auto& engine = arena.create<QuantEngine::BlackScholesEngine<double>>();
+        auto shared = QuantEngine::InstrumentArena::share<QuantEngine::PricingEngine<double>>(engine);
+
+        const std::size_t count = 2000;
+        QuantEngine::EuropeanStockOption<double>* first = nullptr;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto& option = arena.createEuropeanOption<double>({ 1.0, 100.0, 1.0, 100.0, true }, shared, md);
+            if (!first) first = &option;
+        }
+
+        CHECK(arena.objectCount() == count + 1);
+        CHECK(engine.observerCount() == count);
+        CHECK(first->price() == Approx(10.45).margin(0.1));
+        CHECK(upstream.allocations < 20);  // Geometric blocks, not one call per object
+
+        arena.reset();
+        CHECK(arena.objectCount() == 0);
+        CHECK(upstream.live == 0);
+    }
+
+    SECTION("Bulk options can skip engine observation") {
+        QuantEngine::InstrumentArena arena(1 << 16, &upstream);
+        auto& engine = arena.create<QuantEngine::BlackScholesEngine<double>>();
+        auto shared = QuantEngine::InstrumentArena::share<QuantEngine::PricingEngine<double>>(engine);
+
+        auto& option = arena.createEuropeanOption<double>({ 1.0, 100.0, 1.0, 100.0, true }, shared, md, false);
+        CHECK(engine.observerCount() == 0);
+        CHECK(option.price() == Approx(10.45).margin(0.1));
+
+        option.setPricingEngine(shared);     // Single-argument form observes again
+        CHECK(engine.observerCount() == 1);
+    }
+
+    SECTION("Reset runs destructors") {
+        int destroyed = 0;
+        {
+            QuantEngine::InstrumentArena arena(1024, &upstream);
+            arena.create<Tracked>(&destroyed);
+            arena.create<Tracked>(&destroyed);
+            arena.reset();
+            CHECK(destroyed == 2);
+            arena.create<Tracked>(&destroyed);
+        }
+        CHECK(destroyed == 3);  // Destructor resets too
+    }
+
+    SECTION("Arena-backed MarketData copies") {
+        QuantEngine::InstrumentArena arena(1024, &upstream);
+        const QuantEngine::MarketData<double> copy(md, arena.resource());
+        CHECK(copy.getVolatility(100.0, 1.0) == 0.2);
+        CHECK(copy.version() == md.version());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+// Same project headers.
+#include "Core/MarketDataSnapshot.h"
+#include "Core/MarketData.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Unique scratch path inside the system temp directory
+    std::string snapshotPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("quantengine_" + name + ".qemd")).string();
+    }
+}
+
+// =================================================================
+// ROUND TRIP TESTS - Verify mapped snapshots answer like the source MarketData
+// =================================================================
+TEST_CASE("MarketData Snapshot Round Trip", "[MarketData][Snapshot]") {
+    QuantEngine::MarketData<double> md;
+    md.addRiskFreeRate(0.5, 0.02);
+    md.addRiskFreeRate(1.0, 0.03);
+    md.addRiskFreeRate(2.0, 0.035);
+    md.addVolatility(100, 1.0, 0.20);
+    md.addVolatility(100, 2.0, 0.25);
+    md.addVolatility(150, 1.0, 0.22);
+    md.addVolatility(150, 2.0, 0.28);
+    md.addVolatility(200, 1.0, 0.30);  // Leaves (200, 2.0) missing
+
+    const std::string path = snapshotPath("roundtrip");
+    QuantEngine::MarketDataSnapshot<double>::save(md, path);
+    const QuantEngine::MarketDataSnapshot<double> snapshot(path);
+
+    SECTION("Mapped arrays") {
+        REQUIRE(snapshot.rateTimes().size() == 3);
+        REQUIRE(snapshot.strikes().size() == 3);
+        REQUIRE(snapshot.maturities().size() == 2);
+        CHECK(reinterpret_cast<std::uintptr_t>(snapshot.volatilities().data()) % 64 == 0);
+    }
+
+    SECTION("Lookups match the source") {
+        for (double t : { 0.25, 0.75, 1.5, 3.0 }) {
+            CHECK(snapshot.getRiskFreeRate(t) == Approx(md.getRiskFreeRate(t)));
+        }
+        CHECK(snapshot.getVolatility(125, 1.5) == Approx(md.getVolatility(125, 1.5)));
+        CHECK(snapshot.getVolatility(200, 1.0) == 0.30);
+        CHECK_THROWS_AS(snapshot.getVolatility(175, 1.5), std::runtime_error);  // Needs the missing node
+        CHECK_THROWS_AS(snapshot.getVolatility(90, 1.5), std::runtime_error);   // Out of bounds
+    }
+
+    SECTION("MarketData view survives the snapshot object") {
+        QuantEngine::MarketData<double> loaded;
+        {
+            const QuantEngine::MarketDataSnapshot<double> scoped(path);
+            loaded = scoped.toMarketData();
+        }
+        CHECK(loaded.getVolatility(125, 1.5) == Approx(md.getVolatility(125, 1.5)));
+        CHECK(loaded.getRiskFreeRate(1.5) == Approx(md.getRiskFreeRate(1.5)));
+
+        // Re-saving a snapshot-backed MarketData keeps the grid
+        const std::string copyPath = snapshotPath("resave");
+        QuantEngine::MarketDataSnapshot<double>::save(loaded, copyPath);
+        CHECK(QuantEngine::MarketDataSnapshot<double>(copyPath).getVolatility(150, 2.0) == 0.28);
+        std::filesystem::remove(copyPath);
+    }
+
+    SECTION("Attached curve is restored") {
+        md.buildYieldCurve(QuantEngine::YieldCurve<double>::Interpolation::MonotoneConvex);
+        QuantEngine::MarketDataSnapshot<double>::save(md, path);
+        const auto loaded = QuantEngine::MarketDataSnapshot<double>(path).toMarketData();
+
+        REQUIRE(loaded.getYieldCurve() != nullptr);
+        CHECK(loaded.getDiscountFactor(1.5) == Approx(md.getDiscountFactor(1.5)));
+    }
+
+    std::filesystem::remove(path);
+}
+
+// =================================================================
+// VALIDATION TESTS - Reject files that are not matching snapshots
+// =================================================================
+TEST_CASE("MarketData Snapshot Validation", "[MarketData][Snapshot]") {
+    const std::string path = snapshotPath("validation");
+
+    SECTION("Precision mismatch") {
+        QuantEngine::MarketData<float> md;
+        md.addRiskFreeRate(1.0f, 0.03f);
+        QuantEngine::MarketDataSnapshot<float>::save(md, path);
+        REQUIRE_NOTHROW(QuantEngine::MarketDataSnapshot<float>(path));
+        REQUIRE_THROWS_AS(QuantEngine::MarketDataSnapshot<double>(path), std::runtime_error);
+    }
+
+    SECTION("Garbage file") {
+        std::ofstream(path, std::ios::binary) << std::string(256, 'x');
+        REQUIRE_THROWS_AS(QuantEngine::MarketDataSnapshot<double>(path), std::runtime_error);
+    }
+
+    SECTION("Tampered header fields") {
+        using Snapshot = QuantEngine::MarketDataSnapshot<double>;
+        QuantEngine::MarketData<double> md;
+        md.addRiskFreeRate(1.0, 0.03);
+        md.addRiskFreeRate(2.0, 0.04);
+        md.addVolatility(100, 1.0, 0.2);
+        md.buildYieldCurve(QuantEngine::YieldCurve<double>::Interpolation::Linear);
+
+        // Overwrites one header field of the saved snapshot
+        const auto patch = [&](std::size_t offset, const auto& value) {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+
+        Snapshot::save(md, path);
+        patch(offsetof(Snapshot::Header, curveMethod), std::uint32_t{ 7 });
+        REQUIRE_THROWS_AS(Snapshot(path), std::runtime_error);
+
+        // 2^32 x 2^32 wraps to zero vol entries in 64 bits
+        Snapshot::save(md, path);
+        patch(offsetof(Snapshot::Header, strikeCount), std::uint64_t{ 1 } << 32);
+        patch(offsetof(Snapshot::Header, maturityCount), std::uint64_t{ 1 } << 32);
+        REQUIRE_THROWS_AS(Snapshot(path), std::runtime_error);
+    }
+
+    SECTION("Missing file") {
+        REQUIRE_THROWS_AS(QuantEngine::MarketDataSnapshot<double>(path + ".absent"), std::runtime_error);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MarketData Snapshot Concurrent Saves", "[MarketData][Snapshot]") {
+    using Snapshot = QuantEngine::MarketDataSnapshot<double>;
+    const auto directory = std::filesystem::temp_directory_path() / "quantengine_snapshot_writers";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string path = (directory / "market.qemd").string();
+
+    SECTION("Writers never mix their files") {
+        // Each writer's snapshot is internally consistent: every rate equals its own time
+        std::vector<std::thread> writers;
+        for (int w = 1; w <= 4; ++w) {
+            writers.emplace_back([w, &path] {
+                QuantEngine::MarketData<double> md;
+                for (int i = 1; i <= 200 * w; ++i) md.addRiskFreeRate(0.01 * i, 0.01 * i * w);
+                for (int n = 0; n < 20; ++n) Snapshot::save(md, path);
+            });
+        }
+        for (auto& writer : writers) writer.join();
+
+        const Snapshot snapshot(path);
+        const auto times = snapshot.rateTimes();
+        const auto rates = snapshot.rates();
+        const double scale = rates[0] / times[0];
+        REQUIRE(times.size() == static_cast<std::size_t>(200 * std::lround(scale)));
+        for (std::size_t i = 0; i < times.size(); ++i) CHECK(rates[i] == Approx(times[i] * scale));
+        CHECK(std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator{}) == 1);
+    }
+
+    SECTION("A failed save leaves no side file") {
+        std::filesystem::create_directories(path);     // Rename onto a non-empty directory fails
+        std::ofstream(std::filesystem::path(path) / "blocker") << "x";
+        QuantEngine::MarketData<double> md;
+        md.addRiskFreeRate(1.0, 0.03);
+        REQUIRE_THROWS(Snapshot::save(md, path));
+        CHECK(std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator{}) == 1);
+    }
+
+    std::filesystem::remove_all(directory);
+}
\ No newline at end of file
@@ -1,8 +1,12 @@
 // Same project headers.
 #include "Core/MarketData.h"
+#include "Core/MarketDataBuilder.h"
 // 3rd party headers.
 #include "catch2.h"
 // std headers.
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 // =================================================================
 // RISK-FREE RATE TESTS - Verify yield curve management and interpolation
@@ -173,4 +177,140 @@ TEST_CASE("MarketData Stress Tests", "[MarketData][Stress]") {
         md.addVolatility(100, 1.0, 0.22);  // Overwrite volatility
         CHECK(md.getVolatility(100, 1.0) == 0.22);
     }
+}
+
+// =================================================================
+// BUILDER TESTS - Verify bulk loading matches incremental inserts
+// =================================================================
+TEST_CASE("MarketData Bulk Builder", "[MarketData][Builder]") {
+    QuantEngine::MarketDataBuilder<double> builder;
+
+    SECTION("Grid load matches incremental load") {
+        std::vector<double> strikes, maturities, vols;
+        for (int s = 150; s >= 50; s -= 5) strikes.push_back(s);      // Unsorted axis on purpose
+        for (int t = 1; t <= 40; ++t) maturities.push_back(t * 0.25);
+        for (double k : strikes) {
+            for (double t : maturities) vols.push_back(0.2 + k * 0.001 + t * 0.002);
+        }
+
+        QuantEngine::MarketData<double> incremental;
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            for (std::size_t j = 0; j < maturities.size(); ++j) {
+                incremental.addVolatility(strikes[i], maturities[j], vols[i * maturities.size() + j]);
+            }
+        }
+
+        const auto bulk = builder.addRiskFreeRate(1.0, 0.03)
+            .addVolatilityGrid(strikes, maturities, vols)
+            .build();
+
+        CHECK(bulk.getVolatility(100.0, 2.5) == incremental.getVolatility(100.0, 2.5));
+        CHECK(bulk.getVolatility(123.0, 3.1) == Approx(incremental.getVolatility(123.0, 3.1)));
+        CHECK(bulk.getRiskFreeRate(2.0) == 0.03);
+    }
+
+    SECTION("Duplicates keep the last value") {
+        const std::vector<double> times{ 2.0, 1.0, 2.0 };
+        const std::vector<double> rates{ 0.04, 0.03, 0.05 };
+        const std::vector<double> ks{ 100.0, 100.0 }, ts{ 1.0, 1.0 }, vs{ 0.2, 0.22 };
+
+        const auto md = builder.addRiskFreeRates(times, rates).addVolatilities(ks, ts, vs).build();
+        CHECK(md.getRiskFreeRate(2.0) == 0.05);
+        CHECK(md.getVolatility(100.0, 1.0) == 0.22);
+    }
+
+    SECTION("Invalid input") {
+        const std::vector<double> ks{ -100.0 }, ts{ 1.0 }, vs{ 0.2 };
+        REQUIRE_THROWS_AS(builder.addVolatilities(ks, ts, vs), std::invalid_argument);
+        REQUIRE_THROWS_AS(builder.addVolatilityGrid(ks, ts, std::vector<double>{ 0.2, 0.3 }), std::invalid_argument);
+        REQUIRE_THROWS_AS(builder.addRiskFreeRates(ts, std::vector<double>{}), std::invalid_argument);
+    }
+}
+
+// =================================================================
+// COMPACT STORAGE TESTS - Verify float/int16 grids track the full-precision surface
+// =================================================================
+TEST_CASE("MarketData Compact Volatility Storage", "[MarketData][VolSurface][Compact]") {
+    auto makeMarket = []() {
+        QuantEngine::MarketData<double> md;
+        for (int s = 50; s <= 150; s += 5) {
+            for (int t = 1; t <= 10; ++t) {
+                md.addVolatility(s, t * 0.5, 0.15 + s * 0.0007 + t * 0.003);
+            }
+        }
+        return md;
+    };
+    const auto reference = makeMarket();
+
+    SECTION("Float32 nodes") {
+        auto md = makeMarket();
+        md.compressVolatilities(QuantEngine::VolatilityStorage::Float32);
+
+        auto grid = std::dynamic_pointer_cast<const QuantEngine::GridVolSurface<double, float>>(
+            md.getVolatilitySurface());
+        REQUIRE(grid != nullptr);
+        CHECK(grid->footprint() == (21 + 10) * sizeof(float) + 210 * sizeof(float));
+        CHECK(md.getVolatility(100.0, 2.5) == Approx(reference.getVolatility(100.0, 2.5)).margin(1e-7));
+        CHECK(md.getVolatility(87.3, 3.3) == Approx(reference.getVolatility(87.3, 3.3)).margin(1e-6));
+    }
+
+    SECTION("Int16 nodes stay within the quantization step") {
+        auto md = makeMarket();
+        md.compressVolatilities(QuantEngine::VolatilityStorage::Int16);
+
+        auto grid = std::dynamic_pointer_cast<const QuantEngine::GridVolSurface<double, std::int16_t>>(
+            md.getVolatilitySurface());
+        REQUIRE(grid != nullptr);
+        const double tolerance = grid->maxEncodingError() + 1e-7;
+        CHECK(md.getVolatility(100.0, 2.5) == Approx(reference.getVolatility(100.0, 2.5)).margin(tolerance));
+        CHECK(md.getVolatility(121.7, 4.1) == Approx(reference.getVolatility(121.7, 4.1)).margin(tolerance));
+        CHECK_THROWS_AS(md.getVolatility(40.0, 1.0), std::runtime_error);  // Bounds still enforced
+    }
+
+    SECTION("Missing nodes survive quantization") {
+        QuantEngine::MarketData<double> md;
+        md.addVolatility(100, 1.0, 0.20);
+        md.addVolatility(150, 1.0, 0.22);
+        md.addVolatility(100, 2.0, 0.25);  // (150, 2.0) left missing
+        md.compressVolatilities(QuantEngine::VolatilityStorage::Int16);
+
+        CHECK(md.getVolatility(150, 1.0) == Approx(0.22).margin(1e-5));
+        CHECK_THROWS_AS(md.getVolatility(125, 1.5), std::runtime_error);
+    }
+
+    SECTION("Axis edges that float cannot represent stay in bounds") {
+        for (auto storage : { QuantEngine::VolatilityStorage::Float32, QuantEngine::VolatilityStorage::Int16 }) {
+            QuantEngine::MarketData<double> md;
+            md.addVolatility(100.1, 0.1, 0.20);
+            md.addVolatility(100.1, 0.7, 0.24);
+            md.addVolatility(120.3, 0.1, 0.22);
+            md.addVolatility(120.3, 0.7, 0.26);
+            md.compressVolatilities(storage);
+
+            CHECK(md.getVolatility(100.1, 0.1) == Approx(0.20).margin(1e-5));
+            CHECK(md.getVolatility(100.1, 0.7) == Approx(0.24).margin(1e-5));
+            CHECK(md.getVolatility(120.3, 0.7) == Approx(0.26).margin(1e-5));
+            CHECK(md.getVolatility(110.2, 0.4) == Approx(0.23).margin(1e-5));
+            CHECK_THROWS_AS(md.getVolatility(100.1, 0.71), std::runtime_error);
+        }
+    }
+
+    SECTION("Empty surface") {
+        QuantEngine::MarketData<double> md;
+        REQUIRE_THROWS_AS(md.compressVolatilities(QuantEngine::VolatilityStorage::Float32), std::runtime_error);
+    }
+
+    SECTION("Points added after compression are refused, not dropped") {
+        QuantEngine::MarketData<double> md;
+        md.addVolatility(100.0, 1.0, 0.2);
+        md.addVolatility(110.0, 1.0, 0.25);
+        md.addVolatility(100.0, 2.0, 0.22);
+        md.addVolatility(110.0, 2.0, 0.27);
+        md.compressVolatilities(QuantEngine::VolatilityStorage::Float32);
+        const auto version = md.version();
+
+        CHECK_THROWS_AS(md.addVolatility(120.0, 1.0, 0.9), std::logic_error);
+        CHECK(md.version() == version);
+        CHECK(md.getVolatility(105.0, 1.5) == Approx(0.235).margin(1e-6));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Same project headers.
+#include "Core/MemoizedValue.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// =================================================================
+// MEMOIZATION TESTS - Verify refresh policy and single-flight loads
+// =================================================================
+TEST_CASE("Memoized Value", "[MemoizedValue]") {
+    using namespace std::chrono_literals;
+
+    SECTION("Fresh values are served without reloading") {
+        QuantEngine::MemoizedValue<double> memo(1h);
+        int calls = 0;
+        const auto load = [&] { return 0.01 * ++calls; };
+        CHECK(memo.get(load) == Approx(0.01));
+        CHECK(memo.get(load) == Approx(0.01));
+        CHECK(memo.loads() == 1);
+
+        memo.invalidate();
+        CHECK(memo.get(load) == Approx(0.02));
+
+        memo.setMaxAge(0s);
+        CHECK(memo.get(load) == Approx(0.03));
+        CHECK(memo.loads() == 3);
+    }
+
+    SECTION("Concurrent callers share one load") {
+        QuantEngine::MemoizedValue<double> memo(1h);
+        std::atomic<int> calls{ 0 };
+        std::vector<std::thread> threads;
+        std::vector<double> seen(16, 0.0);
+        for (int t = 0; t < 16; ++t) {
+            threads.emplace_back([&, t] {
+                seen[t] = memo.get([&] {
+                    ++calls;
+                    std::this_thread::sleep_for(50ms);
+                    return 0.0525;
+                });
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        CHECK(calls == 1);
+        for (double v : seen) CHECK(v == 0.0525);
+    }
+
+    SECTION("Failed loads cache nothing") {
+        QuantEngine::MemoizedValue<double> memo(1h);
+        CHECK_THROWS_AS(memo.get([]() -> double { throw std::runtime_error("FRED down"); }), std::runtime_error);
+        CHECK(memo.get([] { return 0.04; }) == Approx(0.04));
+        CHECK(memo.loads() == 2);
+    }
+}
+
+// =================================================================
+// ASYNC MEMOIZATION TESTS - Verify callback-driven single flight
+// =================================================================
+TEST_CASE("Memoized Value Async", "[MemoizedValue]") {
+    using namespace std::chrono_literals;
+    QuantEngine::MemoizedValue<double> memo(1h);
+    std::vector<double> seen;
+    const auto record = [&](std::shared_future<double> value) { seen.push_back(value.get()); };
+
+    // Two callers join one load that completes later (e.g. from an I/O thread)
+    int starts = 0;
+    memo.getAsync(record, [&] { ++starts; });
+    memo.getAsync(record, [&] { ++starts; });
+    CHECK(starts == 1);
+    CHECK(seen.empty());
+    memo.complete(0.051);
+    CHECK(seen == std::vector<double>{ 0.051, 0.051 });
+
+    // Fresh value answers at once; blocking and async callers share the cache
+    memo.getAsync(record, [&] { ++starts; });
+    CHECK(memo.get([] { return 1.0; }) == Approx(0.051));
+    CHECK(seen.size() == 3);
+    CHECK(starts == 1);
+
+    // A throwing start fails the load for every waiter
+    memo.invalidate();
+    bool failed = false;
+    memo.getAsync([&](std::shared_future<double> value) {
+        CHECK_THROWS_AS(value.get(), std::runtime_error);
+        failed = true;
+    }, [] { throw std::runtime_error("no key"); });
+    CHECK(failed);
+    CHECK(memo.loads() == 2);
+}
\ No newline at end of file
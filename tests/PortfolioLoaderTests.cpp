@@ -0,0 +1,112 @@
+// Same project headers.
+#include "Core/PortfolioLoader.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace {
+    // Unique scratch path inside the system temp directory
+    std::string tradePath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("quantengine_" + name)).string();
+    }
+
+    std::shared_ptr<const QuantEngine::MarketData<double>> flatMarket(const std::string&) {
+        auto md = std::make_shared<QuantEngine::MarketData<double>>();
+        md->addRiskFreeRate(1.0, 0.05);
+        md->addVolatility(100.0, 1.0, 0.2);
+        return md;
+    }
+}
+
+// =================================================================
+// CSV TESTS - Verify parsing, batch validation and chunk merging
+// =================================================================
+TEST_CASE("Portfolio Loader CSV", "[PortfolioLoader][CSV]") {
+    const std::string csv =
+        "trade_id,underlying,notional,strike,maturity,spot,type\n"
+        "1,AAPL,100,150,0.5,145,call\n"
+        "2,MSFT,50,300,1.0,310,P\r\n"
+        "3,AAPL,10,-5,1.0,145,call\n"      // Bad strike
+        "\n"
+        "4,AAPL,10,150,1.0,145\n"          // Missing field
+        "5,GOOG,1,100,2.0,abc,call\n"      // Bad number
+        "6,GOOG,1,100,2.0,99,C\n";
+
+    const auto trades = QuantEngine::PortfolioLoader<double>::parseCsv(csv, 1);
+
+    SECTION("Valid rows in file order") {
+        REQUIRE(trades.report.loaded == 3);
+        CHECK(trades.tradeIds == std::vector<std::uint64_t>{ 1, 2, 6 });
+        CHECK(trades.underlyings == std::vector<std::string>{ "AAPL", "MSFT", "GOOG" });
+        CHECK(trades.parameters[1].strike_ == 300.0);
+        CHECK_FALSE(trades.parameters[1].isCall_);
+        CHECK(trades.parameters[2].isCall_);
+    }
+
+    SECTION("Rejected rows reported by line") {
+        REQUIRE(trades.report.rejected.size() == 3);
+        CHECK(trades.report.rejected[0].row == 4);
+        CHECK(trades.report.rejected[0].message == "Strike price must be positive");
+        CHECK(trades.report.rejected[1].row == 6);
+        CHECK(trades.report.rejected[2].row == 7);
+        CHECK_FALSE(trades.report.ok());
+    }
+
+    SECTION("Chunked parallel parse matches serial") {
+        std::string big;
+        for (int i = 0; i < 20000; ++i) {
+            big += std::to_string(i) + (i % 3 ? ",AAPL," : ",MSFT,") + "1,100," + (i % 97 ? "1.5" : "0") + ",100,put\n";
+        }
+        const auto serial = QuantEngine::PortfolioLoader<double>::parseCsv(big, 1);
+        const auto parallel = QuantEngine::PortfolioLoader<double>::parseCsv(big, 8);
+        CHECK(parallel.tradeIds == serial.tradeIds);
+        CHECK(parallel.underlyingIndex == serial.underlyingIndex);
+        REQUIRE(parallel.report.rejected.size() == serial.report.rejected.size());
+        CHECK(parallel.report.rejected.back().row == serial.report.rejected.back().row);
+        CHECK(serial.report.rejected.front().row == 1);  // No header line here
+    }
+
+    SECTION("File into a portfolio") {
+        const std::string path = tradePath("trades.csv");
+        std::ofstream(path, std::ios::binary) << csv;
+
+        QuantEngine::Portfolio<double> book;
+        const auto report = QuantEngine::PortfolioLoader<double>::loadCsv(path, book, flatMarket);
+        CHECK(report.loaded == 3);
+        CHECK(book.size() == 3);
+        CHECK(book.underlyingName(book.underlyings()[2]) == "GOOG");
+        std::filesystem::remove(path);
+    }
+}
+
+// =================================================================
+// BINARY TESTS - Verify round trip and header checks
+// =================================================================
+TEST_CASE("Portfolio Loader Binary", "[PortfolioLoader][Binary]") {
+    QuantEngine::Portfolio<double> book;
+    const auto aapl = book.addUnderlying("AAPL", flatMarket("AAPL"));
+    const auto msft = book.addUnderlying("MSFT", flatMarket("MSFT"));
+    for (int i = 0; i < 100; ++i) {
+        book.addTrade(1000 + i, i % 2 ? aapl : msft, { 1.0 + i, 100.0 + i, 0.5, 101.0, i % 3 == 0 });
+    }
+
+    const std::string path = tradePath("trades.qept");
+    QuantEngine::PortfolioLoader<double>::saveBinary(book, path);
+
+    QuantEngine::Portfolio<double> loaded;
+    const auto report = QuantEngine::PortfolioLoader<double>::loadBinary(path, loaded, flatMarket);
+    REQUIRE(report.ok());
+    REQUIRE(loaded.size() == book.size());
+    CHECK(loaded.tradeIds()[42] == 1042);
+    CHECK(loaded.strikes()[42] == 142.0);
+    CHECK(loaded.isCall()[42] == book.isCall()[42]);
+    CHECK(loaded.underlyingName(loaded.underlyings()[1]) == "AAPL");
+
+    // Precision is part of the format
+    CHECK_THROWS_AS(QuantEngine::PortfolioLoader<float>::readBinary(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+// Same project headers.
+#include "Core/Portfolio.h"
+#include "Instruments/EuropeanStockOption.h"
+#include "PricingEngines/BlackScholesEngine.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// =================================================================
+// STORAGE TESTS - Verify column layout and trade bookkeeping
+// =================================================================
+TEST_CASE("Portfolio Columnar Storage", "[Portfolio][Storage]") {
+    auto md = std::make_shared<QuantEngine::MarketData<double>>();
+    md->addRiskFreeRate(1.0, 0.05);
+    md->addVolatility(100.0, 1.0, 0.2);
+
+    QuantEngine::Portfolio<double> book;
+    book.reserve(3);
+    const auto aapl = book.addUnderlying("AAPL", md);
+    const auto msft = book.addUnderlying("MSFT", md);
+
+    book.addTrade(11, aapl, { 1.0, 100.0, 1.0, 100.0, true });
+    book.addTrade(12, msft, { 500.0, 150.0, 0.5, 145.0, false });
+
+    SECTION("Rows round trip") {
+        REQUIRE(book.size() == 2);
+        const auto params = book.parameters(1);
+        CHECK(params.notional_ == 500.0);
+        CHECK(params.strike_ == 150.0);
+        CHECK(params.maturity_ == 0.5);
+        CHECK(params.spotPrice_ == 145.0);
+        CHECK_FALSE(params.isCall_);
+        CHECK(book.tradeIds()[0] == 11);
+        CHECK(book.underlyingName(book.underlyings()[1]) == "MSFT");
+    }
+
+    SECTION("Columns are cache-line aligned") {
+        CHECK(reinterpret_cast<std::uintptr_t>(book.strikes().data()) % 64 == 0);
+        CHECK(reinterpret_cast<std::uintptr_t>(book.isCall().data()) % 64 == 0);
+    }
+
+    SECTION("Underlyings are shared by name") {
+        CHECK(book.underlyingCount() == 2);
+        CHECK(book.addUnderlying("AAPL", md) == aapl);
+        CHECK(book.underlyingId("MSFT") == msft);
+        CHECK_THROWS_AS(book.underlyingId("GOOG"), std::out_of_range);
+    }
+
+    SECTION("Invalid trades rejected") {
+        CHECK_THROWS_AS(book.addTrade(13, aapl, { 1.0, -100.0, 1.0, 100.0, true }), std::invalid_argument);
+        CHECK_THROWS_AS(book.addTrade(13, 99, { 1.0, 100.0, 1.0, 100.0, true }), std::out_of_range);
+        CHECK(book.size() == 2);
+    }
+
+    SECTION("Footprint stays per-field") {
+        CHECK(book.footprint() == 2 * (4 * sizeof(double) + 1 + 8 + 4));
+    }
+}
+
+// =================================================================
+// BATCH PRICING TESTS - Verify engine streaming matches per-instrument pricing
+// =================================================================
+TEST_CASE("Portfolio Batch Pricing", "[Portfolio][Pricing]") {
+    auto md = std::make_shared<QuantEngine::MarketData<double>>();
+    md->addRiskFreeRate(0.5, 0.04);
+    md->addRiskFreeRate(1.0, 0.05);
+    md->addVolatility(100.0, 0.5, 0.22);
+    md->addVolatility(100.0, 1.0, 0.20);
+    md->addVolatility(150.0, 0.5, 0.25);
+    md->addVolatility(150.0, 1.0, 0.24);
+
+    const std::vector<QuantEngine::Instrument<double>::Parameters> trades{
+        { 1.0, 100.0, 1.0, 100.0, true },
+        { 250.0, 120.0, 0.75, 110.0, false },
+        { 10.0, 150.0, 0.5, 140.0, true },
+    };
+
+    QuantEngine::Portfolio<double> book;
+    const auto id = book.addUnderlying("AAPL", md);
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        book.addTrade(i, id, trades[i]);
+    }
+
+    auto engine = std::make_shared<QuantEngine::BlackScholesEngine<double>>();
+    std::vector<double> prices(book.size());
+    engine->calculatePrices(book, prices);
+
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        QuantEngine::EuropeanStockOption<double> option(trades[i]);
+        option.setPricingEngine(engine);
+        option.updateMarketData(*md);
+        CHECK(prices[i] == Approx(option.price()));
+    }
+
+    std::vector<double> wrongSize(1);
+    CHECK_THROWS_AS(engine->calculatePrices(book, wrongSize), std::invalid_argument);
+}
\ No newline at end of file
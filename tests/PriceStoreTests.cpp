@@ -0,0 +1,263 @@
+// Same project headers.
+#include "Core/PriceStore.h"
+#include "Core/ConfigManager.h"
+#include "Core/DataFetcher.h"
+#include "Core/HttpTransport.h"
+#include "TestHelpers.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using QuantEngine::PriceStore;
+    using QuantEngine::referenceVolatility;
+    using QuantEngine::scratch;
+
+    // Columns for n weekday sessions ending at last, closes zig-zagging around 100
+    struct History {
+        std::vector<std::uint32_t> dates;
+        std::vector<double> opens, highs, lows, closes, volumes;
+
+        History(std::uint32_t last, std::size_t n, double drift = 0.0) {
+            using namespace std::chrono;
+            sys_days day{ year_month_day{ year(static_cast<int>(last / 10000)), month(last / 100 % 100), std::chrono::day(last % 100) } };
+            while (dates.size() < n) {
+                const unsigned weekday = year_month_weekday(day).weekday().c_encoding();
+                if (weekday != 0 && weekday != 6) {
+                    const year_month_day ymd(day);
+                    dates.insert(dates.begin(), static_cast<std::uint32_t>(static_cast<int>(ymd.year()) * 10000 +
+                        static_cast<unsigned>(ymd.month()) * 100 + static_cast<unsigned>(ymd.day())));
+                }
+                day -= days(1);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                const double close = 100.0 + drift * i + (i % 2 ? 2.0 : -2.0);
+                opens.push_back(close - 0.5);
+                highs.push_back(close + 1.0);
+                lows.push_back(close - 1.0);
+                closes.push_back(close);
+                volumes.push_back(1.0e6 + i);
+            }
+        }
+
+        PriceStore::Bars bars() const { return { dates, opens, highs, lows, closes, volumes }; }
+
+        // TIME_SERIES_DAILY body, newest session first like the provider
+        std::string body() const {
+            std::string json = "{\"Meta Data\": {\"2. Symbol\": \"X\"}, \"Time Series (Daily)\": {";
+            for (std::size_t i = dates.size(); i-- > 0;) {
+                const std::string d = std::to_string(dates[i]);
+                json += "\"" + d.substr(0, 4) + "-" + d.substr(4, 2) + "-" + d.substr(6, 2) + "\": {" +
+                    "\"1. open\": \"" + std::to_string(opens[i]) + "\", \"2. high\": \"" + std::to_string(highs[i]) +
+                    "\", \"3. low\": \"" + std::to_string(lows[i]) + "\", \"4. close\": \"" + std::to_string(closes[i]) +
+                    "\", \"5. volume\": \"" + std::to_string(static_cast<long long>(volumes[i])) + "\"}" + (i ? "," : "");
+            }
+            return json + "}}";
+        }
+    };
+
+    std::string dailyUrl(const std::string& symbol, const std::string& outputSize) {
+        return "https://www.alphavantage.co/query?function=TIME_SERIES_DAILY&symbol=" + symbol +
+            "&apikey=RECORDED&outputsize=" + outputSize;
+    }
+}
+
+// =================================================================
+// COLUMN STORE TESTS - Verify append-only columns and mapped reads
+// =================================================================
+TEST_CASE("Price Store Columns", "[PriceStore]") {
+    PriceStore store(scratch("price_store"));
+    const History history(20240131, 40);
+
+    SECTION("Appends map back column by column") {
+        CHECK(store.read("IBM").empty());
+        CHECK(store.append("IBM", history.bars()) == 40);
+
+        const auto series = store.read("IBM");
+        REQUIRE(series.size() == 40);
+        CHECK(series.lastDate() == 20240131);
+        CHECK(series.dates().front() == history.dates.front());
+        CHECK(series.closes()[7] == history.closes[7]);
+        CHECK(series.highs()[7] == history.highs[7]);
+        CHECK(series.volumes()[39] == history.volumes[39]);
+    }
+
+    SECTION("Only sessions after the stored history are appended") {
+        const History older(20240125, 30);
+        store.append("IBM", older.bars());
+        const auto before = store.read("IBM");     // Mapping taken before the append stays valid
+
+        CHECK(store.append("IBM", history.bars()) == 4);
+        CHECK(store.append("IBM", history.bars()) == 0);
+        CHECK(store.read("IBM").size() == 34);
+        CHECK(store.read("IBM").lastDate() == 20240131);
+        CHECK(before.size() == 30);
+        CHECK(before.lastDate() == 20240125);
+    }
+
+    SECTION("A torn append is hidden and then overwritten") {
+        store.append("IBM", History(20240125, 30).bars());
+
+        // Crash mid-append: the close column ran ahead of the others
+        {
+            std::ofstream torn(store.directory() / "IBM" / "close.col", std::ios::binary | std::ios::app);
+            const double garbage[3] = { -1.0, -1.0, -1.0 };
+            torn.write(reinterpret_cast<const char*>(garbage), sizeof(garbage));
+        }
+        CHECK(store.read("IBM").size() == 30);
+
+        store.append("IBM", history.bars());
+        const auto series = store.read("IBM");
+        REQUIRE(series.size() == 34);
+        CHECK(series.closes()[30] == history.closes[36]);
+    }
+
+    SECTION("Replace swaps in a longer history") {
+        store.append("IBM", History(20240131, 10).bars());
+        CHECK(store.read("IBM").size() == 10);
+        store.replace("IBM", history.bars());
+        CHECK(store.read("IBM").size() == 40);
+    }
+
+#ifndef _WIN32
+    SECTION("A mapping taken before a replace stays valid") {
+        store.append("IBM", History(20240131, 10).bars());
+        const auto before = store.read("IBM");
+        store.replace("IBM", history.bars());
+        CHECK(store.read("IBM").size() == 40);
+        CHECK(before.size() == 10);
+        CHECK(before.closes()[9] == History(20240131, 10).closes[9]);
+    }
+#endif
+
+    SECTION("Symbols are kept apart and names are sanitized") {
+        store.append("BRK.B", history.bars());
+        store.append("../escape", History(20240131, 5).bars());
+        CHECK(store.read("BRK.B").size() == 40);
+        CHECK(store.read("../escape").size() == 5);
+        CHECK(std::filesystem::exists(store.directory() / "BRK.B"));
+        CHECK(std::filesystem::exists(store.directory() / "_._escape"));
+    }
+
+    SECTION("Invalid bars and corrupt columns are rejected") {
+        History unsorted = history;
+        std::swap(unsorted.dates[3], unsorted.dates[4]);
+        CHECK_THROWS_AS(store.append("IBM", unsorted.bars()), std::invalid_argument);
+
+        PriceStore::Bars ragged = history.bars();
+        ragged.volumes = ragged.volumes.first(10);
+        CHECK_THROWS_AS(store.append("IBM", ragged), std::invalid_argument);
+        CHECK_THROWS_AS(store.append("", history.bars()), std::invalid_argument);
+
+        store.append("IBM", history.bars());
+        {
+            std::fstream column(store.directory() / "IBM" / "low.col", std::ios::binary | std::ios::in | std::ios::out);
+            column.write("NOTMAGIC", 8);
+        }
+        CHECK_THROWS_AS(store.read("IBM"), std::runtime_error);
+    }
+
+    store.clear();
+    CHECK_FALSE(std::filesystem::exists(store.directory()));
+}
+
+// =================================================================
+// SESSION CALENDAR TESTS - Verify completed sessions and gap counts
+// =================================================================
+TEST_CASE("Price Store Session Calendar", "[PriceStore]") {
+    using namespace std::chrono;
+    const sys_days friday{ year(2024) / January / 5 };
+
+    CHECK(PriceStore::lastCompletedSession(friday + hours(20)) == 20240104);
+    CHECK(PriceStore::lastCompletedSession(friday + hours(21)) == 20240105);
+    CHECK(PriceStore::lastCompletedSession(friday + days(1) + hours(12)) == 20240105);
+    CHECK(PriceStore::lastCompletedSession(friday + days(3) + hours(10)) == 20240105);
+
+    CHECK(PriceStore::sessionsBetween(20240105, 20240108) == 1);
+    CHECK(PriceStore::sessionsBetween(20240101, 20240131) == 22);
+    CHECK(PriceStore::sessionsBetween(20240131, 20240101) == 0);
+}
+
+// =================================================================
+// DATA FETCHER TESTS - Verify history is read from the store first
+// =================================================================
+TEST_CASE("Data Fetcher Reads the Price Store First", "[PriceStore][DataFetcher]") {
+    using Fetcher = QuantEngine::DataFetcher;
+    using Transport = QuantEngine::HttpTransport;
+
+    const auto config = scratch("price_store_config");
+    std::ofstream(config / "config.json") << "{\"api_keys\": {\"alpha_vantage\": \"DUMMY\", \"fred\": \"DUMMY\"}}";
+    QuantEngine::ConfigManager::getInstance().loadConfig((config / "config.json").string());
+
+    // Only replayed fixtures can reach the fetcher, so any unexpected download fails
+    QuantEngine::FetcherStateGuard restore;
+    const auto store = std::make_shared<PriceStore>(scratch("price_store_fetcher"));
+    Fetcher::setPriceStore(store);
+    const auto fixtures = scratch("price_store_fixtures");
+    Transport::configure({ Transport::Mode::Replay, fixtures });
+
+    const std::uint32_t target = PriceStore::lastCompletedSession();
+
+    SECTION("An up-to-date store answers without the provider") {
+        const History history(target, 40, 0.1);
+        store->append("LOCAL", history.bars());
+
+        const auto closes = Fetcher::fetchHistoricalPrices("LOCAL", "KEY", 20);
+        CHECK(closes == std::vector<double>(history.closes.end() - 20, history.closes.end()));
+
+        const double vol = Fetcher::fetchHistoricalVolatility("LOCAL", "KEY");
+        CHECK(vol == Approx(referenceVolatility(std::vector<double>(history.closes.end() - 30, history.closes.end()))));
+    }
+
+    SECTION("Missing sessions are topped up from the compact series") {
+        const History stored(target, 43);
+        store->append("GAPPY", History(stored.dates[39], 40).bars());
+
+        // Provider also lists an unfinished session after the target
+        History compact(target, 10);
+        compact.dates.push_back(99991231);
+        for (auto* column : { &compact.opens, &compact.highs, &compact.lows, &compact.closes, &compact.volumes }) {
+            column->push_back(column->back());
+        }
+        Transport::record(dailyUrl("GAPPY", "compact"), compact.body());
+
+        const auto closes = Fetcher::fetchHistoricalPrices("GAPPY", "KEY", 20);
+        REQUIRE(closes.size() == 20);
+        CHECK(closes.back() == Approx(compact.closes[9]));     // Newest completed session, not the unfinished one
+        const auto series = store->read("GAPPY");
+        CHECK(series.size() == 43);
+        CHECK(series.lastDate() == target);
+    }
+
+    SECTION("A longer request backfills from the full series") {
+        store->append("SHORT", History(target, 40).bars());
+        Transport::record(dailyUrl("SHORT", "full"), History(target, 80).body());
+
+        CHECK(Fetcher::fetchHistoricalPrices("SHORT", "KEY", 60).size() == 60);
+        CHECK(store->read("SHORT").size() == 80);
+    }
+
+    SECTION("Stale history is served while the provider refuses") {
+        const History stale(20240105, 40);
+        store->append("STALE", stale.bars());
+        Transport::record(dailyUrl("STALE", "full"), "{\"Note\": \"Thank you for using Alpha Vantage! API call frequency is 5 calls per minute.\"}");
+
+        const auto closes = Fetcher::fetchHistoricalPrices("STALE", "KEY", 10);
+        CHECK(closes == std::vector<double>(stale.closes.end() - 10, stale.closes.end()));
+    }
+
+    SECTION("Nothing stored and nothing recorded fails like the provider path") {
+        CHECK_THROWS_AS(Fetcher::fetchHistoricalPrices("NOWHERE", "KEY", 10), std::runtime_error);
+    }
+
+    store->clear();
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+// Same project headers.
+#include "Core/ResponseCache.h"
+#include "TestHelpers.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+    using Clock = QuantEngine::ResponseCache::Clock;
+
+    // Unix seconds to a clock time point
+    Clock::time_point at(std::int64_t seconds) {
+        return Clock::time_point(std::chrono::seconds(seconds));
+    }
+
+    const std::string Daily = "https://www.alphavantage.co/query?function=TIME_SERIES_DAILY&symbol=AAPL&apikey=KEY1&outputsize=compact";
+}
+
+// =================================================================
+// KEY AND TTL TESTS - Verify normalization and per-endpoint lifetimes
+// =================================================================
+TEST_CASE("Response Cache Keys and TTL", "[ResponseCache]") {
+    using QuantEngine::ResponseCache;
+
+    SECTION("Keys drop credentials and ignore parameter order") {
+        const std::string key = ResponseCache::normalize(Daily);
+        CHECK(key == "https://www.alphavantage.co/query?function=TIME_SERIES_DAILY&outputsize=compact&symbol=AAPL");
+        CHECK(ResponseCache::normalize("https://www.alphavantage.co/query?symbol=AAPL&outputsize=compact&apikey=OTHER&function=TIME_SERIES_DAILY") == key);
+        CHECK(ResponseCache::normalize("https://api.stlouisfed.org/fred/series/observations?series_id=DTB3&api_key=X") ==
+            "https://api.stlouisfed.org/fred/series/observations?series_id=DTB3");
+    }
+
+    SECTION("Key hashes are the same on every platform") {
+        CHECK(ResponseCache::keyHash("") == 0xcbf29ce484222325ull);     // FNV-1a reference values
+        CHECK(ResponseCache::keyHash("a") == 0xaf63dc4c8601ec8cull);
+    }
+
+    SECTION("Lifetimes follow the endpoint") {
+        // 2024-01-03 (Wednesday) 10:00 UTC and 2024-01-05 (Friday) 22:00 UTC
+        const std::int64_t wednesday = 1704276000, friday = 1704492000;
+        CHECK(ResponseCache::timeToLive("https://www.alphavantage.co/query?function=GLOBAL_QUOTE&symbol=AAPL", at(wednesday)) ==
+            ResponseCache::QuoteTtl);
+        CHECK(ResponseCache::timeToLive(Daily, at(wednesday)) == std::chrono::hours(11));
+        CHECK(ResponseCache::timeToLive(Daily, at(friday)) == std::chrono::hours(71));   // Monday 21:00
+        CHECK(ResponseCache::timeToLive("https://api.stlouisfed.org/fred/series/observations?series_id=DTB3", at(wednesday)) ==
+            ResponseCache::RateTtl);
+        CHECK(ResponseCache::timeToLive("https://example.com/other", at(wednesday)).count() == 0);
+    }
+}
+
+// =================================================================
+// STORAGE TESTS - Verify compressed round trips, expiry and corruption
+// =================================================================
+TEST_CASE("Response Cache Storage", "[ResponseCache]") {
+    QuantEngine::ResponseCache cache(QuantEngine::scratch("response_cache"));
+    const std::int64_t now = 1704276000;
+
+    std::string body = "{\"Time Series (Daily)\": {";
+    for (int i = 0; i < 200; ++i) {
+        body += "\"2024-01-" + std::to_string(i) + "\": {\"4. close\": \"101.50\"},";
+    }
+    body += "}}";
+
+    CHECK_FALSE(cache.lookup(Daily, at(now)));
+    cache.store(Daily, body, at(now));
+
+    SECTION("Another API key hits the same entry") {
+        std::string otherKey = Daily;
+        otherKey.replace(otherKey.find("KEY1"), 4, "KEY2");
+        const auto hit = cache.lookup(otherKey, at(now + 60));
+        REQUIRE(hit);
+        CHECK(*hit == body);
+    }
+
+    SECTION("Entries are stored compressed") {
+        std::uintmax_t bytes = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(cache.directory())) {
+            bytes += entry.file_size();
+        }
+        CHECK(bytes < body.size() / 4);
+    }
+
+    SECTION("Stale entries miss") {
+        CHECK_FALSE(cache.lookup(Daily, at(now + 11 * 3600)));
+    }
+
+    SECTION("Corrupt entries miss") {
+        for (const auto& entry : std::filesystem::directory_iterator(cache.directory())) {
+            std::filesystem::resize_file(entry.path(), entry.file_size() - 5);
+        }
+        CHECK_FALSE(cache.lookup(Daily, at(now)));
+    }
+
+    SECTION("An implausible body size misses instead of allocating") {
+        for (const auto& entry : std::filesystem::directory_iterator(cache.directory())) {
+            std::fstream file(entry.path(), std::ios::binary | std::ios::in | std::ios::out);
+            const std::uint64_t huge = std::uint64_t{ 1 } << 62;
+            file.seekp(offsetof(QuantEngine::ResponseCache::Header, bodySize));
+            file.write(reinterpret_cast<const char*>(&huge), sizeof(huge));
+        }
+        CHECK_FALSE(cache.lookup(Daily, at(now)));
+    }
+
+    SECTION("Uncacheable endpoints are not stored and clear empties the cache") {
+        cache.store("https://example.com/other", "x", at(now));
+        CHECK_FALSE(cache.lookup("https://example.com/other", at(now)));
+        cache.clear();
+        CHECK_FALSE(cache.lookup(Daily, at(now)));
+    }
+}
\ No newline at end of file
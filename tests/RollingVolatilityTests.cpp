@@ -0,0 +1,102 @@
+// Same project headers.
+#include "Core/RollingVolatility.h"
+#include "TestHelpers.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    using QuantEngine::referenceVolatility;
+
+    // Geometric random walk starting at 100
+    std::vector<double> randomCloses(std::size_t n, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::normal_distribution<double> shock(0.0, 0.02);
+        std::vector<double> closes{ 100.0 };
+        for (std::size_t i = 1; i < n; ++i) {
+            closes.push_back(closes.back() * std::exp(shock(rng)));
+        }
+        return closes;
+    }
+}
+
+// =================================================================
+// ROLLING VOLATILITY TESTS - Verify streaming updates match full recomputation
+// =================================================================
+TEST_CASE("Rolling Volatility Estimator", "[RollingVolatility]") {
+    using QuantEngine::RollingVolatility;
+    const auto closes = randomCloses(400, 11);
+
+    SECTION("Every window tracks the two-pass estimate as closes stream in") {
+        RollingVolatility<double> estimator({ 10, 30, 90 });
+        std::vector<double> seen;
+        for (double close : closes) {
+            estimator.update(close);
+            seen.push_back(close);
+            if (seen.size() >= 3) {
+                for (std::size_t window : { 10, 30, 90 }) {
+                    CHECK(estimator.volatility(window) == Approx(referenceVolatility(seen, window)).epsilon(1e-10));
+                }
+            }
+        }
+        CHECK(estimator.observations(10) == 10);
+        CHECK(estimator.observations(90) == 90);
+        CHECK(estimator.closes() == closes.size());
+        CHECK(estimator.volatility() == estimator.volatility(10));
+    }
+
+    SECTION("Revising the latest close matches appending it instead") {
+        RollingVolatility<double> revised({ 5, 20 });
+        revised.update(std::span<const double>(closes.data(), 50));
+        revised.revise(closes[49] * 1.03);
+        revised.revise(closes[49] * 0.98);
+
+        std::vector<double> expected(closes.begin(), closes.begin() + 49);
+        expected.push_back(closes[49] * 0.98);
+        CHECK(revised.volatility(5) == Approx(referenceVolatility(expected, 5)).epsilon(1e-10));
+        CHECK(revised.volatility(20) == Approx(referenceVolatility(expected, 20)).epsilon(1e-10));
+
+        // The revised close anchors the next return
+        revised.update(closes[50]);
+        expected.push_back(closes[50]);
+        CHECK(revised.volatility(20) == Approx(referenceVolatility(expected, 20)).epsilon(1e-10));
+    }
+
+    SECTION("Float estimates stay accurate over long streams") {
+        const auto longStream = randomCloses(20000, 5);
+        RollingVolatility<float> estimator({ 30 });
+        for (double close : longStream) {
+            estimator.update(static_cast<float>(close));
+        }
+        CHECK(estimator.volatility(30) == Approx(referenceVolatility(longStream, 30)).epsilon(1e-3));
+    }
+
+    SECTION("Flat prices give zero volatility") {
+        RollingVolatility<double> estimator({ 5 });
+        for (int i = 0; i < 20; ++i) estimator.update(42.0);
+        CHECK(estimator.volatility(5) == 0.0);
+    }
+
+    SECTION("Invalid use is rejected") {
+        CHECK_THROWS_AS(RollingVolatility<double>({}), std::invalid_argument);
+        CHECK_THROWS_AS(RollingVolatility<double>({ 1 }), std::invalid_argument);
+
+        RollingVolatility<double> estimator({ 10 });
+        CHECK_THROWS_AS(estimator.update(0.0), std::invalid_argument);
+        CHECK_THROWS_AS(estimator.revise(100.0), std::logic_error);
+        estimator.update(100.0);
+        estimator.update(101.0);
+        CHECK_THROWS_AS(estimator.volatility(10), std::runtime_error);
+        CHECK_THROWS_AS(estimator.volatility(20), std::invalid_argument);
+
+        estimator.update(99.0);
+        CHECK(estimator.volatility(10) > 0.0);
+        estimator.reset();
+        CHECK(estimator.closes() == 0);
+        CHECK(estimator.observations(10) == 0);
+    }
+}
\ No newline at end of file
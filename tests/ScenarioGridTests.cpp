@@ -0,0 +1,75 @@
+// Same project headers.
+#include "Risk/ScenarioGrid.h"
+#include "PricingEngines/BlackScholesEngine.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <memory>
+#include <vector>
+
+// =================================================================
+// SCENARIO TESTS - Verify grid values against bumped engine prices
+// =================================================================
+TEST_CASE("Spot x Vol Scenario Grid", "[Risk][Scenario]") {
+    auto md = std::make_shared<QuantEngine::MarketData<double>>();
+    md->addRiskFreeRate(0.5, 0.04);
+    md->addRiskFreeRate(2.0, 0.05);
+    md->addVolatility(80.0, 0.5, 0.24);
+    md->addVolatility(80.0, 2.0, 0.22);
+    md->addVolatility(120.0, 0.5, 0.20);
+    md->addVolatility(120.0, 2.0, 0.19);
+
+    QuantEngine::Portfolio<double> book;
+    const auto id = book.addUnderlying("AAPL", md);
+    book.addTrade(1, id, { 10.0, 100.0, 1.0, 100.0, true });
+    book.addTrade(2, id, { 5.0, 110.0, 1.5, 100.0, false });
+
+    const auto grid = QuantEngine::ScenarioGrid<double>::ladder(0.10, 21, 0.05, 11);
+    REQUIRE(grid.spotCount() == 21);
+    REQUIRE(grid.volCount() == 11);
+
+    // Reference: reprice through the engine with a bumped spot and a flat bumped vol
+    const QuantEngine::BlackScholesEngine<double> engine;
+    auto bumped = [&](std::size_t row, double spotShock, double volShock) {
+        auto params = book.parameters(row);
+        const double sigma = md->getVolatility(params.strike_, params.maturity_) + volShock;
+        QuantEngine::MarketData<double> shocked;
+        shocked.addRiskFreeRate(params.maturity_, md->getRiskFreeRate(params.maturity_));
+        shocked.addVolatility(params.strike_, params.maturity_, sigma);
+        params.spotPrice_ *= 1 + spotShock;
+        QuantEngine::Portfolio<double> single;
+        single.addTrade(0, single.addUnderlying("X", std::make_shared<QuantEngine::MarketData<double>>(shocked)), params);
+        std::vector<double> price(1);
+        engine.calculatePrices(single, price);
+        return price[0];
+    };
+
+    SECTION("Book values match bumped repricing") {
+        const auto result = grid.revalue(book, 4);
+        for (std::size_t i : { 0u, 7u, 10u, 20u }) {
+            for (std::size_t j : { 0u, 5u, 10u }) {
+                const double expected = bumped(0, result.spotShocks[i], result.volShocks[j]) +
+                    bumped(1, result.spotShocks[i], result.volShocks[j]);
+                CHECK(result.at(i, j) == Approx(expected).epsilon(1e-10));
+            }
+        }
+
+        // Centre of a symmetric ladder is the unshocked book
+        CHECK(result.pnl(10, 5) == Approx(0.0).margin(1e-9));
+        CHECK(result.pnl(20, 5) > 0);  // Net long delta
+    }
+
+    SECTION("Per-trade values sum to the book") {
+        std::vector<double> perTrade(book.size() * 21 * 11);
+        grid.revalueTrades(book, perTrade);
+        const auto result = grid.revalue(book, 1);
+        CHECK(perTrade[3 * 11 + 2] + perTrade[231 + 3 * 11 + 2] == Approx(result.at(3, 2)));
+        std::vector<double> wrongSize(5);
+        CHECK_THROWS_AS(grid.revalueTrades(book, wrongSize), std::invalid_argument);
+    }
+
+    SECTION("Invalid shocks") {
+        CHECK_THROWS_AS(QuantEngine::ScenarioGrid<double>({ -1.0 }, { 0.0 }), std::invalid_argument);
+        CHECK_THROWS_AS(QuantEngine::ScenarioGrid<double>({}, { 0.0 }), std::invalid_argument);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+// Same project headers.
+#include "Core/SviVolSurface.h"
+#include "Core/MarketData.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace {
+    // Builds noiseless quotes from known SVI parameters
+    QuantEngine::SviSliceQuotes<double> makeQuotes(const QuantEngine::SviParameters<double>& p,
+        double maturity, double forward) {
+        QuantEngine::SviSliceQuotes<double> q{ maturity, forward, {}, {} };
+        for (double k = -0.6; k <= 0.6001; k += 0.1) {
+            q.strikes.push_back(forward * std::exp(k));
+            q.vols.push_back(std::sqrt(p.totalVariance(k) / maturity));
+        }
+        return q;
+    }
+}
+
+// =================================================================
+// EVALUATION TESTS - Verify parametric evaluation and interpolation
+// =================================================================
+TEST_CASE("SVI Surface Evaluation", "[VolSurface][SVI]") {
+    const QuantEngine::SviParameters<double> p1{ 0.01, 0.10, -0.4, 0.0, 0.2 };
+    const QuantEngine::SviParameters<double> p2{ 0.03, 0.12, -0.3, 0.05, 0.25 };
+    const QuantEngine::SviVolSurface<double> surface({ 0.5, 1.0 }, { 100.0, 102.0 }, { p1, p2 });
+
+    SECTION("Slice maturities reproduce the slice") {
+        CHECK(surface.volatility(100.0, 0.5) == Approx(std::sqrt(p1.totalVariance(0.0) / 0.5)));
+        CHECK(surface.volatility(110.0, 1.0) ==
+            Approx(std::sqrt(p2.totalVariance(std::log(110.0 / 102.0)) / 1.0)));
+    }
+
+    SECTION("Total variance is linear in time between slices") {
+        const double w = surface.totalVariance(0.1, 0.75);
+        CHECK(w == Approx(0.5 * p1.totalVariance(0.1) + 0.5 * p2.totalVariance(0.1)));
+    }
+
+    SECTION("Flat implied vol outside slices") {
+        CHECK(surface.volatility(100.0, 0.25) == Approx(surface.volatility(100.0, 0.5)));
+        CHECK(surface.volatility(102.0, 3.0) == Approx(surface.volatility(102.0, 1.0)));
+    }
+
+    SECTION("Calendar check") {
+        CHECK(surface.isCalendarArbitrageFree({ -0.5, -0.25, 0.0, 0.25, 0.5 }));
+    }
+}
+
+TEST_CASE("SVI Parameter Validation", "[VolSurface][SVI][Validation]") {
+    using P = QuantEngine::SviParameters<double>;
+    REQUIRE_THROWS_AS((P{ 0.01, -0.1, 0.0, 0.0, 0.1 }.validate()), std::invalid_argument);  // b < 0
+    REQUIRE_THROWS_AS((P{ 0.01, 0.1, 1.0, 0.0, 0.1 }.validate()), std::invalid_argument);   // |rho| = 1
+    REQUIRE_THROWS_AS((P{ -0.5, 0.1, 0.0, 0.0, 0.1 }.validate()), std::invalid_argument);   // Negative variance
+    REQUIRE_THROWS_AS((P{ 0.01, 1.9, 0.5, 0.0, 0.1 }.validate()), std::invalid_argument);   // Lee bound
+    REQUIRE_NOTHROW((P{ 0.01, 0.1, -0.5, 0.0, 0.1 }.validate()));
+}
+
+// =================================================================
+// CALIBRATION TESTS - Recover known parameters from synthetic quotes
+// =================================================================
+TEST_CASE("SVI Calibration", "[VolSurface][SVI][Calibration]") {
+    const QuantEngine::SviParameters<double> p1{ 0.02, 0.15, -0.5, 0.02, 0.15 };
+    const QuantEngine::SviParameters<double> p2{ 0.04, 0.18, -0.4, 0.05, 0.20 };
+    const QuantEngine::SviParameters<double> p3{ 0.07, 0.20, -0.3, 0.08, 0.25 };
+    const std::vector<QuantEngine::SviSliceQuotes<double>> quotes{
+        makeQuotes(p2, 1.0, 101.0), makeQuotes(p1, 0.5, 100.5), makeQuotes(p3, 2.0, 102.0) };
+
+    const auto surface = QuantEngine::SviVolSurface<double>::calibrate(quotes, nullptr, 3);
+    REQUIRE(surface.sliceCount() == 3);
+
+    SECTION("Slices come back sorted and fit the quotes") {
+        CHECK(surface.maturity(0) == 0.5);
+        CHECK(surface.maturity(2) == 2.0);
+        for (const auto& q : quotes) {
+            for (std::size_t j = 0; j < q.strikes.size(); ++j) {
+                CHECK(surface.volatility(q.strikes[j], q.maturity) == Approx(q.vols[j]).margin(1e-4));
+            }
+        }
+    }
+
+    SECTION("Warm start reproduces the same fit") {
+        const auto refit = QuantEngine::SviVolSurface<double>::calibrate(quotes, &surface, 2);
+        for (std::size_t i = 0; i < refit.sliceCount(); ++i) {
+            CHECK(refit.volatility(refit.forward(i), refit.maturity(i)) ==
+                Approx(surface.volatility(surface.forward(i), surface.maturity(i))).margin(1e-5));
+        }
+    }
+
+    SECTION("Too few quotes") {
+        QuantEngine::SviSliceQuotes<double> thin{ 1.0, 100.0, { 100.0, 110.0 }, { 0.2, 0.21 } };
+        REQUIRE_THROWS_AS(QuantEngine::SviVolSurface<double>::calibrateSlice(thin), std::invalid_argument);
+    }
+}
+
+// =================================================================
+// SSVI & MARKETDATA TESTS - Verify arbitrage checks and MarketData hookup
+// =================================================================
+TEST_CASE("SSVI Surface", "[VolSurface][SSVI]") {
+    SECTION("ATM total variance equals theta") {
+        const QuantEngine::SsviVolSurface<double> ssvi({ 0.5, 1.0 }, { 100.0, 100.0 },
+            { 0.02, 0.045 }, -0.6, 1.0, 0.4);
+        CHECK(ssvi.totalVariance(0.0, 1.0) == Approx(0.045));
+        CHECK(ssvi.volatility(100.0, 1.0) == Approx(std::sqrt(0.045)));
+    }
+
+    SECTION("Arbitrage constraints") {
+        // Decreasing ATM variance is calendar arbitrage
+        REQUIRE_THROWS_AS(QuantEngine::SsviVolSurface<double>({ 0.5, 1.0 }, { 100.0, 100.0 },
+            { 0.05, 0.04 }, -0.6, 1.0, 0.4), std::invalid_argument);
+        // eta * (1 + |rho|) > 2 allows butterfly arbitrage
+        REQUIRE_THROWS_AS(QuantEngine::SsviVolSurface<double>({ 1.0 }, { 100.0 },
+            { 0.04 }, -0.6, 1.5, 0.4), std::invalid_argument);
+    }
+}
+
+TEST_CASE("MarketData Attached Volatility Surface", "[VolSurface][MarketData]") {
+    QuantEngine::MarketData<double> md;
+    auto ssvi = std::make_shared<QuantEngine::SsviVolSurface<double>>(
+        std::vector<double>{ 1.0 }, std::vector<double>{ 100.0 }, std::vector<double>{ 0.04 }, -0.5, 1.0, 0.5);
+    md.setVolatilitySurface(ssvi);
+
+    // Surface serves any strike/maturity without grid points
+    CHECK(md.getVolatility(100.0, 1.0) == Approx(0.2));
+    CHECK(md.getVolatility(80.0, 2.0) == Approx(ssvi->volatility(80.0, 2.0)));
+}
\ No newline at end of file
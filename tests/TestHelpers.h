@@ -0,0 +1,73 @@
+// Ensures the headers are only included once.
+#pragma once
+
+// Same project headers.
+#include "Core/DataFetcher.h"
+#include "Core/HttpTransport.h"
+#include "Core/PriceStore.h"
+#include "Core/ResponseCache.h"
+// 3rd party headers.
+// ....
+// std headers.
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace QuantEngine {
+    // Fresh, empty scratch directory inside the system temp directory
+    inline std::filesystem::path scratch(const std::string& name) {
+        const auto dir = std::filesystem::temp_directory_path() / ("quantengine_" + name);
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        return dir;
+    }
+
+    // Two-pass annualized volatility of the last window log returns of closes (all of them by default)
+    inline double referenceVolatility(const std::vector<double>& closes,
+        std::size_t window = std::numeric_limits<std::size_t>::max()) {
+        std::vector<double> returns;
+        for (std::size_t i = 1; i < closes.size(); ++i) {
+            returns.push_back(std::log(closes[i] / closes[i - 1]));
+        }
+        if (returns.size() > window) {
+            returns.erase(returns.begin(), returns.end() - static_cast<std::ptrdiff_t>(window));
+        }
+        double mean = 0.0;
+        for (double r : returns) mean += r;
+        mean /= returns.size();
+        double variance = 0.0;
+        for (double r : returns) variance += (r - mean) * (r - mean);
+        return std::sqrt(variance / (returns.size() - 1) * 252.0);
+    }
+
+    // Scoped DataFetcher state for tests that replay fixtures through the fetcher
+    // Starts with no response cache, no price store and no memoized rate; on scope exit (a failed REQUIRE
+    // included) the transport goes back to live and the previous cache and store are reinstalled
+    class FetcherStateGuard {
+    public:
+        FetcherStateGuard()
+            : cache_(DataFetcher::responseCache()), store_(DataFetcher::priceStore()) {
+            DataFetcher::setResponseCache(nullptr);
+            DataFetcher::setPriceStore(nullptr);
+            DataFetcher::invalidateRiskFreeRate();
+        }
+
+        ~FetcherStateGuard() {
+            HttpTransport::configure({});
+            DataFetcher::setResponseCache(cache_);
+            DataFetcher::setPriceStore(store_);
+            DataFetcher::invalidateRiskFreeRate();
+        }
+
+        FetcherStateGuard(const FetcherStateGuard&) = delete;
+        FetcherStateGuard& operator=(const FetcherStateGuard&) = delete;
+
+    private:
+        std::shared_ptr<ResponseCache> cache_;
+        std::shared_ptr<PriceStore> store_;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+// Same project headers.
+#include "Core/TimeSeriesParser.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <stdexcept>
+#include <string>
+
+namespace {
+    // TIME_SERIES_DAILY body for January sessions 1..n, newest first like the provider sends it
+    // Close on day d is 100 + d
+    std::string dailyBody(int n) {
+        std::string body = "{\"Meta Data\": {\"1. Information\": \"Daily Prices\", \"2. Symbol\": \"IBM\"},"
+            "\"Time Series (Daily)\": {";
+        for (int d = n; d >= 1; --d) {
+            const std::string day = (d < 10 ? "0" : "") + std::to_string(d);
+            body += "\"2024-01-" + day + "\": {\"1. open\": \"99.0\", \"2. high\": \"101.0\", \"3. low\": \"98.5\","
+                "\"4. close\": \"" + std::to_string(100 + d) + ".5000\", \"5. volume\": \"123456\"}";
+            body += d > 1 ? "," : "";
+        }
+        return body + "}}";
+    }
+}
+
+// =================================================================
+// EXTRACTION TESTS - Verify closes come out oldest first and trimmed to the newest sessions
+// =================================================================
+TEST_CASE("Time Series SAX Extraction", "[TimeSeriesParser]") {
+    using QuantEngine::TimeSeriesParser;
+
+    SECTION("Most recent sessions, oldest first") {
+        const auto series = TimeSeriesParser::parseDaily(dailyBody(31), 30);
+        REQUIRE(series.hasSeries);
+        CHECK_FALSE(series.refused());
+        REQUIRE(series.closes.size() == 30);
+        CHECK(series.closes.front() == 102.5);      // Jan 2 (Jan 1 dropped as oldest)
+        CHECK(series.closes.back() == 131.5);       // Jan 31
+        CHECK(series.dates.front() == 20240102u);
+        CHECK(series.dates.back() == 20240131u);
+    }
+
+    SECTION("Full bars ride along on request") {
+        const auto closesOnly = TimeSeriesParser::parseDaily(dailyBody(5));
+        CHECK(closesOnly.opens.empty());
+        CHECK(closesOnly.volumes.empty());
+
+        const auto bars = TimeSeriesParser::parseDailyBars(dailyBody(5), 3);
+        REQUIRE(bars.closes.size() == 3);
+        REQUIRE(bars.opens.size() == 3);
+        CHECK(bars.dates.front() == 20240103u);
+        CHECK(bars.opens.front() == 99.0);
+        CHECK(bars.highs.front() == 101.0);
+        CHECK(bars.lows.front() == 98.5);
+        CHECK(bars.closes.front() == 103.5);
+        CHECK(bars.volumes.back() == 123456.0);
+    }
+
+    SECTION("Unordered sessions are sorted and whole histories kept") {
+        const std::string body = "{\"Time Series (Daily)\": {\"2024-01-03\": {\"4. close\": \"3\"},"
+            "\"2024-01-01\": {\"4. close\": \"1\"}, \"2024-01-02\": {\"4. close\": \"2\"}}}";
+        const auto series = TimeSeriesParser::parseDaily(body);
+        CHECK(series.closes == std::vector<double>{ 1.0, 2.0, 3.0 });
+    }
+
+    SECTION("Refusals are reported instead of data") {
+        const std::string note = "{\"Note\": \"Thank you for using Alpha Vantage! Our standard API call frequency is 5 calls per minute.\"}";
+        const auto series = TimeSeriesParser::parseDaily(note);
+        CHECK_FALSE(series.hasSeries);
+        CHECK(series.refused());
+        CHECK(series.rateLimited());
+        CHECK(TimeSeriesParser::refused(note));
+        CHECK(TimeSeriesParser::refused("{\"error_code\": 400, \"error_message\": \"Bad Request\"}"));
+        CHECK(TimeSeriesParser::refused("{\"Time Series (Daily)\": "));
+        CHECK_FALSE(TimeSeriesParser::refused(dailyBody(3)));
+        CHECK_FALSE(TimeSeriesParser::refused("{\"observations\": [{\"value\": \"5.25\"}]}"));
+    }
+
+    SECTION("Malformed input throws") {
+        CHECK_THROWS_AS(TimeSeriesParser::parseDaily("{\"Time Series (Daily)\": {"), std::runtime_error);
+        CHECK_THROWS_AS(TimeSeriesParser::parseDaily("{\"Time Series (Daily)\": {\"2024-01-01\": {\"4. close\": \"abc\"}}}"),
+            std::runtime_error);
+    }
+}
\ No newline at end of file
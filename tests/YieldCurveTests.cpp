@@ -0,0 +1,123 @@
+// Same project headers.
+#include "Core/YieldCurve.h"
+#include "Core/MarketData.h"
+// 3rd party headers.
+#include "catch2.h"
+// std headers.
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using Curve = QuantEngine::YieldCurve<double>;
+
+// =================================================================
+// INTERPOLATION TESTS - Verify each scheme reproduces the quoted nodes
+// =================================================================
+TEST_CASE("YieldCurve Node Reproduction", "[YieldCurve][Interpolation]") {
+    const std::vector<double> times{ 0.25, 0.5, 1.0, 2.0, 5.0 };
+    const std::vector<double> rates{ 0.040, 0.042, 0.045, 0.047, 0.050 };
+
+    for (auto method : { Curve::Interpolation::Linear,
+                         Curve::Interpolation::CubicSpline,
+                         Curve::Interpolation::MonotoneConvex }) {
+        const Curve curve(times, rates, method);
+
+        // Every quoted node must be hit exactly
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            CHECK(curve.zeroRate(times[i]) == Approx(rates[i]).margin(1e-12));
+            CHECK(curve.discountFactor(times[i]) == Approx(std::exp(-rates[i] * times[i])));
+        }
+
+        // Flat extrapolation past the last node
+        CHECK(curve.zeroRate(10.0) == Approx(0.050));
+    }
+}
+
+TEST_CASE("YieldCurve Linear Matches MarketData", "[YieldCurve][Interpolation]") {
+    QuantEngine::MarketData<double> md;
+    md.addRiskFreeRate(0.5, 0.02);
+    md.addRiskFreeRate(1.0, 0.03);
+    md.addRiskFreeRate(2.0, 0.035);
+
+    const Curve curve({ 0.5, 1.0, 2.0 }, { 0.02, 0.03, 0.035 }, Curve::Interpolation::Linear);
+
+    // Same answers as the map-based interpolation, including flat ends
+    for (double t : { 0.25, 0.5, 0.75, 1.5, 2.0, 3.0 }) {
+        CHECK(curve.zeroRate(t) == Approx(md.getRiskFreeRate(t)));
+    }
+}
+
+TEST_CASE("YieldCurve Monotone Convex Forwards", "[YieldCurve][MonotoneConvex]") {
+    // Upward sloping curve should give positive, monotone-in-segment discount factors
+    const Curve curve({ 0.5, 1.0, 2.0, 5.0, 10.0 }, { 0.01, 0.015, 0.02, 0.03, 0.035 },
+        Curve::Interpolation::MonotoneConvex);
+
+    double previous = 1.0;
+    for (double t = 0.05; t < 10.0; t += 0.05) {
+        const double df = curve.discountFactor(t);
+        CHECK(df < previous);  // Strictly decreasing means positive forwards
+        previous = df;
+    }
+}
+
+// =================================================================
+// BATCH & CACHE TESTS - Verify batch and cached paths agree with scalar path
+// =================================================================
+TEST_CASE("YieldCurve Batch Evaluation", "[YieldCurve][Batch]") {
+    const Curve curve({ 0.25, 1.0, 3.0, 7.0 }, { 0.03, 0.032, 0.036, 0.04 },
+        Curve::Interpolation::CubicSpline);
+
+    // Mix of sorted and unsorted times, including both extrapolation regions
+    const std::vector<double> times{ 0.0, 0.1, 0.5, 1.0, 2.5, 6.0, 9.0, 0.75, 4.0 };
+    std::vector<double> out(times.size());
+    curve.discountFactors(times, out);
+
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        CHECK(out[i] == Approx(curve.discountFactor(times[i])));
+    }
+
+    std::vector<double> tooSmall(2);
+    REQUIRE_THROWS_AS(curve.discountFactors(times, tooSmall), std::invalid_argument);
+
+    // Far more distinct maturities than cache slots: lookups stay exact as entries are replaced
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 1; i <= 4 * static_cast<int>(Curve::DiscountCacheSlots); ++i) {
+            const double t = i / 97.0;
+            REQUIRE(curve.cachedDiscountFactor(t) == curve.discountFactor(t));
+        }
+    }
+}
+
+TEST_CASE("MarketData Attached Yield Curve", "[YieldCurve][MarketData]") {
+    QuantEngine::MarketData<double> md;
+    md.addRiskFreeRate(1.0, 0.03);
+    md.addRiskFreeRate(2.0, 0.04);
+
+    SECTION("Discount factor without curve") {
+        CHECK(md.getDiscountFactor(1.5) == Approx(std::exp(-0.035 * 1.5)));
+    }
+
+    SECTION("Copies share the attached curve") {
+        md.buildYieldCurve(Curve::Interpolation::MonotoneConvex);
+        const QuantEngine::MarketData<double> copy = md;
+
+        REQUIRE(copy.getYieldCurve() == md.getYieldCurve());
+        CHECK(copy.getDiscountFactor(2.0) == Approx(std::exp(-0.04 * 2.0)));
+        CHECK(md.getDiscountFactor(2.0) == copy.getDiscountFactor(2.0));
+    }
+
+    SECTION("New rate points drop a stale curve") {
+        md.buildYieldCurve(Curve::Interpolation::Linear);
+        md.addRiskFreeRate(3.0, 0.05);
+        CHECK(md.getYieldCurve() == nullptr);
+        CHECK(md.getRiskFreeRate(3.0) == Approx(0.05));
+    }
+}
+
+TEST_CASE("YieldCurve Invalid Input", "[YieldCurve][Validation]") {
+    REQUIRE_THROWS_AS(Curve({}, {}), std::invalid_argument);
+    REQUIRE_THROWS_AS(Curve({ 1.0 }, { 0.01, 0.02 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(Curve({ 1.0, 1.0 }, { 0.01, 0.02 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(Curve({ -1.0 }, { 0.01 }), std::invalid_argument);
+    REQUIRE_THROWS_AS(Curve({ 1.0, 2.0 }, { 0.01, 0.02 }, static_cast<Curve::Interpolation>(9)), std::invalid_argument);
+}
\ No newline at end of file